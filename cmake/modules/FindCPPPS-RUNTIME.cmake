@@ -0,0 +1,3 @@
+include(${CMAKE_CURRENT_LIST_DIR}/cppps_module_helper.cmake)
+CPPPS_ADD_MODULE("runtime" cppps-runtime-static cppps::runtime)
+CPPPS_ADD_MODULE("runtime" cppps-runtime-shared cppps::runtime-shared)
@@ -5,6 +5,7 @@
 #ifndef APPINFO_H
 #define APPINFO_H
 
+#include <chrono>
 #include <string>
 
 namespace cppps {
@@ -16,6 +17,13 @@ struct AppInfo
   std::string appVersionPage;
   int columnWidth {40};
   bool interruptable {true};
+  std::chrono::milliseconds stopDeadline {0}; // default plugin stop deadline, 0 for none
+  bool parallelLifecycle {false}; // start and stop independent plugins concurrently
+  std::chrono::milliseconds phaseTimeout {0}; // parallel start/stop phase timeout, 0 for none
+  bool fastExit {false}; // terminate after exec() without unloading the plugins
+  bool prefetchPlugins {false}; // read the plugin files ahead in the background before loading them
+  bool pipelinedBoot {false}; // prepare the loaded plugins while the next ones are being loaded
+  std::string helpCachePath; // help page cache serving --help without loading the plugins, empty for none
 };
 
 } // namespace cppps
@@ -9,48 +9,182 @@
 #include "cppps/dl/AppInfo.h"
 #include "cppps/dl/PluginSystem.h"
 #include "cppps/dl/PluginCollector.h"
+#include "cppps/dl/PluginSelection.h"
+#include "cppps/dl/EpollReactor.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace cppps {
 
+class Cli;
+class IPluginLoader;
+
 class Application: public IApplication
 {
 public:
   using Directories = std::list<std::string>;
+  using Bundles = std::list<std::string>;
   using OnBeforeCliParseHook = std::function<void(const ICliPtr& cli)>;
+  using LoopExitCodes = std::list<std::pair<std::string, int>>;
 
   Application(const AppInfo& appInfo);
   virtual ~Application();
 
   void setPluginDirectories(const Directories& dirs);
+
+  /**
+   * @brief Load the plugins also from the plugin bundles (see PluginBundle)
+   */
+  void setPluginBundles(const Bundles& bundles);
   static std::string getAppDirPath();
   void preloadPlugin(IPluginUPtr&& plugin);
+
+  /**
+   * @brief Add a plugin to the running application
+   *
+   * The plugin is prepared, resolved against the resources of the
+   * running plugins, initialized and started; the running plugins are
+   * not touched again. Options added to the command line by the plugin
+   * keep their default values. Can be called from any thread once all
+   * the plugins have been started (e.g. from a reactor task).
+   */
+  void addPlugin(IPluginUPtr&& plugin);
+
+  /**
+   * @brief Replace a running plugin of the same name
+   * @see reloadPlugin()
+   */
+  void replacePlugin(IPluginUPtr&& plugin);
+
   int exec(int argc, char** argv);
   int exec();
 
   void addOnBeforeCliParseHook(const OnBeforeCliParseHook& hook);
 
+  /**
+   * @brief Get the exit codes of the named loops in the order of addition
+   */
+  const LoopExitCodes& getLoopExitCodes() const;
+
+  /**
+   * @brief Get the stop durations of the plugins from the last quit()
+   */
+  const PluginSystem::StopReport& getStopReport() const;
+
+  /**
+   * @brief Get the critical path of the plugin initialization
+   *
+   * Printed after the start when the application is run
+   * with the --startup-report flag.
+   */
+  PluginSystem::StartupReport getStartupReport() const;
+
+  struct LoadReportEntry
+  {
+    std::string pluginPath;
+    std::chrono::microseconds duration; // opening the library and creating the plugin
+    long majorFaults; // page faults served from the disk, -1 if not measured
+  };
+
+  using LoadReport = std::list<LoadReportEntry>;
+
+  /**
+   * @brief Get the load times of the plugins loaded by exec(), in the load order
+   *
+   * Printed with the startup report.
+   */
+  const LoadReport& getLoadReport() const;
+
+  /**
+   * @brief Stop the plugins, call the exit flush hooks and terminate the process
+   *
+   * Skips unloading the plugins, destroying them and closing their
+   * libraries (static destructors included), which may take longer than
+   * the work of a short-lived tool. Called by exec() when AppInfo::fastExit
+   * is set; should be called from the thread that called exec().
+   */
+  [[noreturn]] void exitFast(int exitCode);
+
   // IApplication
   void quit() override;
   void setMainLoop(const MainLoop& loop) override;
+  void addMainLoop(const std::string& name, const MainLoop& loop, int cpu = ANY_CPU) override;
+  const ResourceRegistry& getResourceRegistry() const override;
+  HookId addOnPluginStoppedHook(const OnPluginStoppedHook& hook) override;
+  void removeOnPluginStoppedHook(HookId id) override;
+  void setStopDeadline(const std::string& pluginName,
+                       std::chrono::milliseconds deadline) override;
+  void addOnExitFlushHook(const OnExitFlushHook& hook) override;
+  void loadPlugin(const std::string& pluginPath) override;
+  void reloadPlugin(const std::string& pluginPath) override;
+  IReactor& getReactor() override;
 
 private:
   AppInfo appInfo;
   Directories pluginDirs;
+  Bundles pluginBundles;
   PluginSystem pluginSystem;
   PluginSystem::LoadedPlugins preloadedPlugins;
   MainLoop mainLoop {nullptr};
-  bool quitCalled {false};
+
+  struct NamedLoop
+  {
+    std::string name;
+    MainLoop loop;
+    int cpu;
+    std::thread thread;
+    int exitCode {EXIT_SUCCESS};
+    std::exception_ptr exception {nullptr};
+  };
+
+  std::list<NamedLoop> namedLoops;
+  std::atomic<size_t> runningLoops {0};
+  LoopExitCodes loopExitCodes;
+  std::unique_ptr<EpollReactor> reactor;
+  std::atomic_bool quitCalled {false};
+  bool quitFinished {false};
+  std::mutex quitMutex;
+  std::condition_variable quitFinishedCondition;
+  std::thread signalThread;
   std::list<OnBeforeCliParseHook> onBeforeCliParseHooks;
+  std::list<OnExitFlushHook> onExitFlushHooks;
+  ICliPtr cli {nullptr};
+  bool pluginsStarted {false};
+  bool startupReportRequested {false};
+  PluginSelection pluginSelection;
+  std::string pluginsOption;
+  std::string disabledPluginsOption;
+  std::list<std::string> builtinPluginNames;
+  std::string helpFingerprint;
+  LoadReport loadReport;
+  std::recursive_mutex lifecycleMutex;
 
 private:
   enum class CliParseResult {QUIT, CONTINUE};
   PluginCollector::Paths collectPlugins();
+  PluginSystem::LoadedPlugins collectBuiltinPlugins();
   void loadPlugins(const PluginCollector::Paths& pluginPaths);
-  CliParseResult parseCli(int argc, char** argv);
+  IPluginDPtr loadMeasured(IPluginLoader& loader, const std::string& pluginPath);
+  PluginCollector::Paths bootPipelined(PluginSystem::LoadedPlugins& builtinPlugins);
+  void updateHelpFingerprint(const PluginCollector::Paths& pluginPaths);
+  bool printCachedHelp();
+  std::shared_ptr<Cli> createCli();
+  CliParseResult parseCli(const std::shared_ptr<Cli>& cli, int argc, char** argv);
   int execMainLoop();
+  void startNamedLoops();
+  int joinNamedLoops(int result);
+  void addStartedPlugin(IPluginDPtr&& plugin);
+  void replaceStartedPlugin(IPluginDPtr&& plugin);
+  void waitForQuit();
   void setupInterruptHandler();
+  void restoreInterruptHandler();
 
 };
 
@@ -16,10 +16,20 @@ namespace cppps {
 class Cli final: public ICli
 {
 public:
+  enum class EarlyRequest {NONE, HELP, VERSION};
 
   explicit Cli(const AppInfo& appInfo);
   ~Cli() final;
 
+  /**
+   * @brief Find the help or version request before the options are added
+   *
+   * Lets the application answer such requests without loading the plugins.
+   * The first of the standard flags (-h, --help, -v, --version) found
+   * before the "--" separator is reported.
+   */
+  static EarlyRequest findEarlyRequest(int argc, char* argv[]);
+
   void parse(int argc, char* argv[]);
 
   [[nodiscard]] bool shouldAppQuit() const;
@@ -28,6 +38,11 @@ public:
 
   [[nodiscard]] const std::string& getMessage() const;
 
+  /**
+   * @brief Get the help page including all added options
+   */
+  [[nodiscard]] std::string getHelp() const;
+
   // ICli interface
   void addOption(std::string_view option, std::string& target,
                  std::string_view description, bool defaulted = true) override;
@@ -5,11 +5,17 @@
 #ifndef DIGRAPH_H
 #define DIGRAPH_H
 
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <list>
 #include <set>
 #include <map>
+#include <optional>
 #include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace cppps {
 
@@ -21,6 +27,8 @@ class NoSuchNodeException: public std::runtime_error {
   using runtime_error::runtime_error;
 };
 
+template <class K, class T>
+class DigraphScheduler;
 
 /**
  * @brief Directed graph utility class.
@@ -31,6 +39,22 @@ class NoSuchNodeException: public std::runtime_error {
  * is used to generate unique key. In most cases a
  * KeyProvider will be a simple lambda returning the
  * T member value that identifies the object.
+ *
+ * The topological order is maintained incrementally
+ * (Pearce-Kelly): an edge breaking the order only reorders
+ * the nodes placed between its ends, and a cycle is detected
+ * by the insertion of the edge that closes it. Once the graph
+ * becomes cyclic, the order is rebuilt from scratch when the
+ * graph gets acyclic again after a removal.
+ *
+ * Reachability queries are answered from a bit matrix of the
+ * transitive closure for small acyclic graphs (computed on the
+ * first query after a change) and by a graph search otherwise.
+ * The queries are const but not thread-safe, as they may update
+ * the cached closure.
+ *
+ * Use the DigraphScheduler to process the nodes
+ * on many threads in the topological order.
  */
 template <class K, class T>
 class Digraph
@@ -40,6 +64,13 @@ public:
   using SortedNodes = std::list<T>;
   using Cycle = std::list<T>;
   using Cycles = std::list<Cycle>;
+  using Keys = std::list<K>;
+
+  /**
+   * Graphs above this size are searched instead of keeping the
+   * transitive closure (size * size bits).
+   */
+  static constexpr size_t CLOSURE_NODE_LIMIT = 1024;
 
   Digraph(KeyProvider keyProvider);
 
@@ -76,8 +107,79 @@ public:
    */
   void addEdge(const T& startNode, const T& endNode);
 
+  /**
+   * @brief Add an edge unless it closes a cycle
+   * @param startNode Tail node key
+   * @param endNode Head node key
+   * @return false if the edge would close a cycle (the graph is not changed)
+   */
+  bool addAcyclicEdge(const K& startNode, const K& endNode);
+
+  /**
+   * @brief Remove the node and all its edges
+   *
+   * @param key Node identifier
+   */
+  void removeNode(const K& key);
+
+  /**
+   * @brief Remove the edge between nodes identified by given keys
+   * @param startNode Tail node
+   * @param endNode Head node
+   * @return false if there was no such edge
+   */
+  bool removeEdge(const K& startNode, const K& endNode);
+
+  /**
+   * @brief Remove the edge between existing nodes
+   * @param startNode Tail node
+   * @param endNode Head node
+   * @return false if there was no such edge
+   */
+  bool removeEdge(const T& startNode, const T& endNode);
+
+  /**
+   * @brief Check if the graph has no cycles
+   */
+  bool isAcyclic() const;
+
+  /**
+   * @brief Get the heads of the edges starting at the node
+   */
+  Keys getSuccessors(const K& key) const;
+
+  /**
+   * @brief Get the tails of the edges ending at the node
+   */
+  Keys getPredecessors(const K& key) const;
+
+  /**
+   * @brief Get the nodes reachable from the node
+   * @return Node keys, in the topological order unless the graph has cycles;
+   * the node itself is included only if it lies on a cycle
+   */
+  Keys getDescendants(const K& key) const;
+
+  /**
+   * @brief Get the nodes from which the node is reachable
+   * @return Node keys, in the topological order unless the graph has cycles;
+   * the node itself is included only if it lies on a cycle
+   */
+  Keys getAncestors(const K& key) const;
+
+  /**
+   * @brief Check if there is a path (of at least one edge) between the nodes
+   * @param startNode First node of the path
+   * @param endNode Last node of the path
+   */
+  bool isReachable(const K& startNode, const K& endNode) const;
+
   /**
    * @brief Perform topological sort of collected nodes.
+   *
+   * Heads precede their tails. The incrementally maintained
+   * order is copied unless the graph has cycles.
+   *
    * @return Topologically soorted list of copied T elements.
    */
   SortedNodes topologicalSort() const;
@@ -95,20 +197,44 @@ public:
   inline size_t size() const;
 
 private:
+  template <class, class> friend class DigraphScheduler;
+
   using Index = size_t;
   using BoolNodes = std::vector<bool>;
 
+  static constexpr Index NO_INDEX = static_cast<Index>(-1);
+
   struct Node
   {
-    T data;
+    std::optional<T> data; // re-emplaced when the node is moved to another index
     std::set<Index> nextNodes;
+    std::set<Index> prevNodes;
   };
 
   KeyProvider getKey;
   std::vector<Node> nodes;
   std::unordered_map<K, Index> keyIndexMap;
 
+  // order slots may be left empty (NO_INDEX) by removed nodes
+  std::vector<Index> order;
+  std::vector<size_t> positions;
+  size_t emptySlots {0};
+  bool orderValid {true};
+
+  // row i: the nodes reachable from node i
+  mutable std::vector<uint64_t> closure;
+  mutable size_t closureRowWords {0};
+  mutable bool closureValid {false};
+
 private:
+  Index getIndex(const K& key) const;
+  bool reorder(Index startIndex, Index endIndex);
+  void rebuildOrder();
+  void compactOrder();
+  bool updateClosure() const;
+  bool hasClosureBit(Index startIndex, Index endIndex) const;
+  bool search(Index startIndex, bool forward, Index targetIndex, BoolNodes& visited) const;
+  Keys toKeys(const BoolNodes& marked) const;
   void advanceTopologicalSort(Index index, SortedNodes& sortedNodes, BoolNodes& visited) const;
   void advanceFindCycle(Index index, Cycle& cycle, BoolNodes& visited) const;
 
@@ -139,8 +265,11 @@ void Digraph<K, T>::addNode(T data)
     throw DuplicatedNodeException("Directed Graph error: the node with key "
                                   + key + " already exists");
   }
-  nodes.push_back({data, {}});
+  nodes.push_back({std::move(data), {}, {}});
   keyIndexMap.insert(std::make_pair(key, nodes.size() - 1));
+  positions.push_back(order.size());
+  order.push_back(nodes.size() - 1);
+  closureValid = false;
 }
 
 
@@ -151,24 +280,23 @@ T& Digraph<K, T>::getNode(const K& key)
   if (it == keyIndexMap.end()) {
     throw NoSuchNodeException("Graph node not found: " + key);
   }
-  return nodes[it->second].data;
+  return *nodes[it->second].data;
 }
 
 
 template <class K, class T>
 void Digraph<K, T>::addEdge(const K& startNode, const K& endNode)
 {
-  auto startIt = keyIndexMap.find(startNode);
-  if (startIt == keyIndexMap.end()) {
-    throw NoSuchNodeException("No such node: " + startNode);
-  }
+  auto startIndex = getIndex(startNode);
+  auto endIndex = getIndex(endNode);
 
-  auto endIt = keyIndexMap.find(endNode);
-  if (endIt == keyIndexMap.end()) {
-    throw NoSuchNodeException("No such node: " + endNode);
+  // a cycle is accepted here and reported by findCycles()
+  if (orderValid && !reorder(startIndex, endIndex)) {
+    orderValid = false;
   }
-
-  nodes[startIt->second].nextNodes.insert(endIt->second);
+  nodes[startIndex].nextNodes.insert(endIndex);
+  nodes[endIndex].prevNodes.insert(startIndex);
+  closureValid = false;
 }
 
 
@@ -179,12 +307,214 @@ void Digraph<K, T>::addEdge(const T& startNode, const T& endNode)
 }
 
 
+template <class K, class T>
+bool Digraph<K, T>::addAcyclicEdge(const K& startNode, const K& endNode)
+{
+  auto startIndex = getIndex(startNode);
+  auto endIndex = getIndex(endNode);
+
+  if (orderValid) {
+    if (!reorder(startIndex, endIndex)) {
+      return false;
+    }
+  }
+  else {
+    // the order is unknown, so look for a path back to the tail
+    std::vector<Index> pending {endIndex};
+    std::unordered_set<Index> visited {endIndex};
+    while (!pending.empty()) {
+      auto index = pending.back();
+      pending.pop_back();
+      if (index == startIndex) {
+        return false;
+      }
+      for (auto nextIndex: nodes[index].nextNodes) {
+        if (visited.insert(nextIndex).second) {
+          pending.push_back(nextIndex);
+        }
+      }
+    }
+  }
+
+  nodes[startIndex].nextNodes.insert(endIndex);
+  nodes[endIndex].prevNodes.insert(startIndex);
+  closureValid = false;
+  return true;
+}
+
+
+template <class K, class T>
+void Digraph<K, T>::removeNode(const K& key)
+{
+  auto index = getIndex(key);
+  keyIndexMap.erase(key);
+  closureValid = false;
+  for (auto nextIndex: nodes[index].nextNodes) {
+    nodes[nextIndex].prevNodes.erase(index);
+  }
+  for (auto prevIndex: nodes[index].prevNodes) {
+    nodes[prevIndex].nextNodes.erase(index);
+  }
+  order[positions[index]] = NO_INDEX;
+  ++emptySlots;
+
+  // move the last node into the freed index
+  auto lastIndex = nodes.size() - 1;
+  if (index != lastIndex) {
+    auto& lastNode = nodes[lastIndex];
+    for (auto nextIndex: lastNode.nextNodes) {
+      if (nextIndex != lastIndex) {
+        nodes[nextIndex].prevNodes.erase(lastIndex);
+        nodes[nextIndex].prevNodes.insert(index);
+      }
+    }
+    for (auto prevIndex: lastNode.prevNodes) {
+      if (prevIndex != lastIndex) {
+        nodes[prevIndex].nextNodes.erase(lastIndex);
+        nodes[prevIndex].nextNodes.insert(index);
+      }
+    }
+    if (lastNode.nextNodes.erase(lastIndex) > 0) {
+      lastNode.nextNodes.insert(index);
+      lastNode.prevNodes.erase(lastIndex);
+      lastNode.prevNodes.insert(index);
+    }
+    keyIndexMap[getKey(*lastNode.data)] = index;
+    order[positions[lastIndex]] = index;
+    positions[index] = positions[lastIndex];
+    nodes[index].data.emplace(std::move(*lastNode.data));
+    nodes[index].nextNodes = std::move(lastNode.nextNodes);
+    nodes[index].prevNodes = std::move(lastNode.prevNodes);
+  }
+  nodes.pop_back();
+  positions.pop_back();
+
+  if (emptySlots * 2 > order.size()) {
+    compactOrder();
+  }
+  if (!orderValid) {
+    rebuildOrder();
+  }
+}
+
+
+template <class K, class T>
+bool Digraph<K, T>::removeEdge(const K& startNode, const K& endNode)
+{
+  auto startIndex = getIndex(startNode);
+  auto endIndex = getIndex(endNode);
+  if (nodes[startIndex].nextNodes.erase(endIndex) == 0) {
+    return false;
+  }
+  nodes[endIndex].prevNodes.erase(startIndex);
+  closureValid = false;
+
+  // removing an edge never breaks a valid order
+  if (!orderValid) {
+    rebuildOrder();
+  }
+  return true;
+}
+
+
+template <class K, class T>
+bool Digraph<K, T>::removeEdge(const T& startNode, const T& endNode)
+{
+  return removeEdge(getKey(startNode), getKey(endNode));
+}
+
+
+template <class K, class T>
+bool Digraph<K, T>::isAcyclic() const
+{
+  return orderValid;
+}
+
+
+template <class K, class T>
+typename Digraph<K, T>::Keys Digraph<K, T>::getSuccessors(const K& key) const
+{
+  Keys keys;
+  for (auto nextIndex: nodes[getIndex(key)].nextNodes) {
+    keys.push_back(getKey(*nodes[nextIndex].data));
+  }
+  return keys;
+}
+
+
+template <class K, class T>
+typename Digraph<K, T>::Keys Digraph<K, T>::getPredecessors(const K& key) const
+{
+  Keys keys;
+  for (auto prevIndex: nodes[getIndex(key)].prevNodes) {
+    keys.push_back(getKey(*nodes[prevIndex].data));
+  }
+  return keys;
+}
+
+
+template <class K, class T>
+typename Digraph<K, T>::Keys Digraph<K, T>::getDescendants(const K& key) const
+{
+  auto index = getIndex(key);
+  BoolNodes marked(nodes.size(), false);
+  if (updateClosure()) {
+    for (Index i = 0; i < nodes.size(); ++i) {
+      marked[i] = hasClosureBit(index, i);
+    }
+  }
+  else {
+    search(index, true, NO_INDEX, marked);
+  }
+  return toKeys(marked);
+}
+
+
+template <class K, class T>
+typename Digraph<K, T>::Keys Digraph<K, T>::getAncestors(const K& key) const
+{
+  auto index = getIndex(key);
+  BoolNodes marked(nodes.size(), false);
+  if (updateClosure()) {
+    for (Index i = 0; i < nodes.size(); ++i) {
+      marked[i] = hasClosureBit(i, index);
+    }
+  }
+  else {
+    search(index, false, NO_INDEX, marked);
+  }
+  return toKeys(marked);
+}
+
+
+template <class K, class T>
+bool Digraph<K, T>::isReachable(const K& startNode, const K& endNode) const
+{
+  auto startIndex = getIndex(startNode);
+  auto endIndex = getIndex(endNode);
+  if (updateClosure()) {
+    return hasClosureBit(startIndex, endIndex);
+  }
+
+  BoolNodes visited(nodes.size(), false);
+  return search(startIndex, true, endIndex, visited);
+}
+
+
 template <class K, class T>
 typename Digraph<K, T>::SortedNodes Digraph<K, T>::topologicalSort() const
 {
   SortedNodes sortedNodes;
-  BoolNodes visited(nodes.size(), false);
+  if (orderValid) {
+    for (auto index: order) {
+      if (index != NO_INDEX) {
+        sortedNodes.push_back(*nodes[index].data);
+      }
+    }
+    return sortedNodes;
+  }
 
+  BoolNodes visited(nodes.size(), false);
   for (Index i = 0; i < nodes.size(); ++i) {
     if (!visited.at(i)) {
       advanceTopologicalSort(i, sortedNodes, visited);
@@ -213,6 +543,210 @@ typename Digraph<K, T>::Cycles Digraph<K, T>::findCycles() const
 }
 
 
+template <class K, class T>
+typename Digraph<K, T>::Index Digraph<K, T>::getIndex(const K& key) const
+{
+  auto it = keyIndexMap.find(key);
+  if (it == keyIndexMap.end()) {
+    throw NoSuchNodeException("No such node: " + key);
+  }
+  return it->second;
+}
+
+
+template <class K, class T>
+bool Digraph<K, T>::reorder(Index startIndex, Index endIndex)
+{
+  // the head has to precede the tail
+  auto lowerBound = positions[startIndex];
+  auto upperBound = positions[endIndex];
+  if (upperBound < lowerBound) {
+    return true;
+  }
+  if (startIndex == endIndex) {
+    return false;
+  }
+
+  // the tail and the nodes following it, placed before the head
+  std::vector<Index> following {startIndex};
+  std::unordered_set<Index> visited {startIndex};
+  for (size_t i = 0; i < following.size(); ++i) {
+    for (auto prevIndex: nodes[following[i]].prevNodes) {
+      if (prevIndex == endIndex) {
+        return false;
+      }
+      if (positions[prevIndex] < upperBound && visited.insert(prevIndex).second) {
+        following.push_back(prevIndex);
+      }
+    }
+  }
+
+  // the head and the nodes preceding it, placed after the tail
+  std::vector<Index> preceding {endIndex};
+  visited.insert(endIndex);
+  for (size_t i = 0; i < preceding.size(); ++i) {
+    for (auto nextIndex: nodes[preceding[i]].nextNodes) {
+      if (positions[nextIndex] > lowerBound && visited.insert(nextIndex).second) {
+        preceding.push_back(nextIndex);
+      }
+    }
+  }
+
+  // reuse the slots of the affected nodes, moving the preceding nodes first
+  auto byPosition = [this](Index lhs, Index rhs){return positions[lhs] < positions[rhs];};
+  std::sort(following.begin(), following.end(), byPosition);
+  std::sort(preceding.begin(), preceding.end(), byPosition);
+
+  std::vector<size_t> slots;
+  for (auto index: preceding) {
+    slots.push_back(positions[index]);
+  }
+  for (auto index: following) {
+    slots.push_back(positions[index]);
+  }
+  std::sort(slots.begin(), slots.end());
+
+  preceding.insert(preceding.end(), following.begin(), following.end());
+  for (size_t i = 0; i < slots.size(); ++i) {
+    order[slots[i]] = preceding[i];
+    positions[preceding[i]] = slots[i];
+  }
+  return true;
+}
+
+
+template <class K, class T>
+void Digraph<K, T>::rebuildOrder()
+{
+  // Kahn's algorithm: a node is placed after all its heads
+  std::vector<size_t> pendingCounts(nodes.size());
+  std::vector<Index> newOrder;
+  for (Index i = 0; i < nodes.size(); ++i) {
+    pendingCounts[i] = nodes[i].nextNodes.size();
+    if (pendingCounts[i] == 0) {
+      newOrder.push_back(i);
+    }
+  }
+  for (size_t i = 0; i < newOrder.size(); ++i) {
+    for (auto prevIndex: nodes[newOrder[i]].prevNodes) {
+      if (--pendingCounts[prevIndex] == 0) {
+        newOrder.push_back(prevIndex);
+      }
+    }
+  }
+
+  if (newOrder.size() != nodes.size()) {
+    return; // still cyclic
+  }
+  order = std::move(newOrder);
+  for (size_t i = 0; i < order.size(); ++i) {
+    positions[order[i]] = i;
+  }
+  emptySlots = 0;
+  orderValid = true;
+}
+
+
+template <class K, class T>
+void Digraph<K, T>::compactOrder()
+{
+  std::vector<Index> newOrder;
+  newOrder.reserve(nodes.size());
+  for (auto index: order) {
+    if (index != NO_INDEX) {
+      positions[index] = newOrder.size();
+      newOrder.push_back(index);
+    }
+  }
+  order = std::move(newOrder);
+  emptySlots = 0;
+}
+
+
+template <class K, class T>
+bool Digraph<K, T>::updateClosure() const
+{
+  if (!orderValid || nodes.size() > CLOSURE_NODE_LIMIT) {
+    return false;
+  }
+  if (closureValid) {
+    return true;
+  }
+
+  // heads precede their tails, so the rows of the heads are ready
+  closureRowWords = (nodes.size() + 63) / 64;
+  closure.assign(nodes.size() * closureRowWords, 0);
+  for (auto index: order) {
+    if (index == NO_INDEX) {
+      continue;
+    }
+    auto* row = &closure[index * closureRowWords];
+    for (auto nextIndex: nodes[index].nextNodes) {
+      const auto* nextRow = &closure[nextIndex * closureRowWords];
+      for (size_t word = 0; word < closureRowWords; ++word) {
+        row[word] |= nextRow[word];
+      }
+      row[nextIndex / 64] |= uint64_t(1) << (nextIndex % 64);
+    }
+  }
+  closureValid = true;
+  return true;
+}
+
+
+template <class K, class T>
+bool Digraph<K, T>::hasClosureBit(Index startIndex, Index endIndex) const
+{
+  auto word = closure[startIndex * closureRowWords + endIndex / 64];
+  return (word >> (endIndex % 64)) & 1;
+}
+
+
+template <class K, class T>
+bool Digraph<K, T>::search(Index startIndex, bool forward, Index targetIndex,
+                           BoolNodes& visited) const
+{
+  std::vector<Index> pending {startIndex};
+  while (!pending.empty()) {
+    auto index = pending.back();
+    pending.pop_back();
+    const auto& adjacentNodes = forward ? nodes[index].nextNodes : nodes[index].prevNodes;
+    for (auto adjacentIndex: adjacentNodes) {
+      if (adjacentIndex == targetIndex) {
+        return true;
+      }
+      if (!visited[adjacentIndex]) {
+        visited[adjacentIndex] = true;
+        pending.push_back(adjacentIndex);
+      }
+    }
+  }
+  return false;
+}
+
+
+template <class K, class T>
+typename Digraph<K, T>::Keys Digraph<K, T>::toKeys(const BoolNodes& marked) const
+{
+  Keys keys;
+  if (orderValid) {
+    for (auto index: order) {
+      if (index != NO_INDEX && marked[index]) {
+        keys.push_back(getKey(*nodes[index].data));
+      }
+    }
+  }
+  else {
+    for (Index i = 0; i < nodes.size(); ++i) {
+      if (marked[i]) {
+        keys.push_back(getKey(*nodes[i].data));
+      }
+    }
+  }
+  return keys;
+}
+
+
 template <class K, class T>
 void Digraph<K, T>::advanceTopologicalSort(Digraph<K, T>::Index index,
                                            Digraph<K, T>::SortedNodes& sortedNodes,
@@ -227,7 +761,7 @@ void Digraph<K, T>::advanceTopologicalSort(Digraph<K, T>::Index index,
     }
   }
 
-  sortedNodes.push_back(node.data);
+  sortedNodes.push_back(*node.data);
 }
 
 
@@ -246,7 +780,7 @@ void Digraph<K, T>::advanceFindCycle(Digraph<K, T>::Index index,
   for (auto& nextNodeIndex: node.nextNodes) {
     if (visited.at(nextNodeIndex)) { // cycle found
       for (Index i = nextNodeIndex; i <= index; ++i) {
-        cycle.push_back(nodes.at(i).data);
+        cycle.push_back(*nodes.at(i).data);
       }
       break;
     }
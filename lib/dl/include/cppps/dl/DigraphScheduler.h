@@ -0,0 +1,317 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef DIGRAPHSCHEDULER_H
+#define DIGRAPHSCHEDULER_H
+
+#include "cppps/dl/Digraph.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cppps {
+
+/**
+ * @brief Concurrent executor of the Digraph nodes.
+ *
+ * Every node keeps an atomic counter of the nodes it waits for.
+ * A node whose counter drops to zero is put into the ready queue
+ * and dispatched to the first free worker thread, so independent
+ * nodes are processed in parallel while the dependency order is kept.
+ *
+ * In the DEPENDENCIES_FIRST order (the order of topologicalSort())
+ * a node waits for the nodes its edges point to; in the
+ * DEPENDENTS_FIRST order it waits for the nodes pointing to it.
+ * Nodes which never get ready (e.g. the ones forming a cycle)
+ * are reported as skipped.
+ *
+ * The graph must not be modified while run() is in progress.
+ *
+ * Example:
+ * @code
+ * Digraph<std::string, Task> graph([](const Task& task){return task.name;});
+ * // ... add nodes and edges (from a task to the tasks it depends on)
+ *
+ * DigraphScheduler<std::string, Task> scheduler(graph);
+ * scheduler.setThreadCount(4);
+ * scheduler.run([](Task& task, bool){task.execute();});
+ * @endcode
+ */
+template <class K, class T>
+class DigraphScheduler
+{
+public:
+  enum class Order {DEPENDENCIES_FIRST, DEPENDENTS_FIRST};
+  enum class TimeoutPolicy {SKIP, FORCE};
+
+  /**
+   * @param data Node data object
+   * @param forced The node has been dispatched after the timeout,
+   * before the nodes it waits for are done
+   */
+  using Action = std::function<void(T& data, bool forced)>;
+  using Keys = std::list<K>;
+
+  explicit DigraphScheduler(Digraph<K, T>& graph, Order order = Order::DEPENDENCIES_FIRST);
+
+  /**
+   * @brief Set the number of worker threads
+   * @param count Maximum number of threads, 0 for the hardware concurrency
+   */
+  void setThreadCount(size_t count);
+
+  /**
+   * @brief Bound the time of the run() call
+   * @param timeout Run timeout, 0 for none
+   * @param policy SKIP: do not dispatch the remaining nodes after the timeout;
+   * FORCE: dispatch all the remaining nodes at once
+   */
+  void setTimeout(std::chrono::milliseconds timeout, TimeoutPolicy policy);
+
+  /**
+   * @brief Call the action for every node of the graph
+   *
+   * Once an action throws, no more nodes are dispatched and the
+   * first exception is rethrown after the calls in progress return.
+   *
+   * @param action Action called on the worker threads
+   * @return Keys of the nodes that have not been dispatched
+   */
+  Keys run(const Action& action);
+
+private:
+  using Index = size_t;
+
+  struct RunState
+  {
+    explicit RunState(size_t nodeCount);
+
+    std::unique_ptr<std::atomic<size_t>[]> pendingCounts;
+    std::vector<bool> queued;
+    std::vector<bool> dispatched;
+    std::vector<bool> forced;
+    std::deque<Index> ready;
+    size_t inFlight {0};
+    size_t finished {0};
+    bool stopDispatching {false};
+    bool closing {false};
+    std::exception_ptr exception {nullptr};
+    std::mutex mutex;
+    std::condition_variable readyCondition;
+    std::condition_variable doneCondition;
+  };
+
+  Digraph<K, T>& graph;
+  std::vector<size_t> waitCounts;
+  std::vector<std::vector<Index>> dependents;
+  size_t threadCount {0};
+  std::chrono::milliseconds timeout {0};
+  TimeoutPolicy timeoutPolicy {TimeoutPolicy::SKIP};
+
+private:
+  void enqueue(RunState& state, Index index) const;
+  void work(RunState& state, const Action& action);
+  bool isDone(const RunState& state) const;
+};
+
+// ---------
+
+template <class K, class T>
+DigraphScheduler<K, T>::RunState::RunState(size_t nodeCount)
+  : pendingCounts{std::make_unique<std::atomic<size_t>[]>(nodeCount)}
+  , queued(nodeCount, false)
+  , dispatched(nodeCount, false)
+  , forced(nodeCount, false)
+{
+  // empty
+}
+
+
+template <class K, class T>
+DigraphScheduler<K, T>::DigraphScheduler(Digraph<K, T>& graph, Order order)
+  : graph{graph}
+  , waitCounts(graph.nodes.size(), 0)
+  , dependents(graph.nodes.size())
+{
+  for (Index i = 0; i < graph.nodes.size(); ++i) {
+    for (auto nextIndex: graph.nodes[i].nextNodes) {
+      if (order == Order::DEPENDENCIES_FIRST) {
+        ++waitCounts[i];
+        dependents[nextIndex].push_back(i);
+      }
+      else {
+        ++waitCounts[nextIndex];
+        dependents[i].push_back(nextIndex);
+      }
+    }
+  }
+}
+
+
+template <class K, class T>
+void DigraphScheduler<K, T>::setThreadCount(size_t count)
+{
+  threadCount = count;
+}
+
+
+template <class K, class T>
+void DigraphScheduler<K, T>::setTimeout(std::chrono::milliseconds timeout,
+                                        TimeoutPolicy policy)
+{
+  this->timeout = timeout;
+  timeoutPolicy = policy;
+}
+
+
+template <class K, class T>
+typename DigraphScheduler<K, T>::Keys DigraphScheduler<K, T>::run(const Action& action)
+{
+  const auto nodeCount = waitCounts.size();
+  if (nodeCount == 0) {
+    return {};
+  }
+
+  RunState state(nodeCount);
+  for (Index i = 0; i < nodeCount; ++i) {
+    state.pendingCounts[i] = waitCounts[i];
+    if (waitCounts[i] == 0) {
+      enqueue(state, i);
+    }
+  }
+
+  auto workerCount = (threadCount > 0) ? threadCount
+                                       : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  workerCount = std::min(workerCount, nodeCount);
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < workerCount; ++i) {
+    workers.emplace_back([this, &state, &action](){work(state, action);});
+  }
+
+  Keys skippedKeys;
+  {
+    std::unique_lock<std::mutex> lock(state.mutex);
+    auto done = [this, &state](){return isDone(state);};
+    if (timeout.count() > 0 && !state.doneCondition.wait_for(lock, timeout, done)) {
+      if (timeoutPolicy == TimeoutPolicy::FORCE && !state.stopDispatching) {
+        for (Index i = 0; i < nodeCount; ++i) {
+          if (!state.queued[i]) {
+            state.forced[i] = true;
+            enqueue(state, i);
+          }
+        }
+      }
+      else {
+        state.stopDispatching = true;
+        state.ready.clear();
+      }
+    }
+    state.doneCondition.wait(lock, done);
+
+    state.closing = true;
+    for (Index i = 0; i < nodeCount; ++i) {
+      if (!state.dispatched[i]) {
+        skippedKeys.push_back(graph.getKey(*graph.nodes[i].data));
+      }
+    }
+  }
+  state.readyCondition.notify_all();
+
+  for (auto& worker: workers) {
+    worker.join();
+  }
+
+  if (state.exception) {
+    std::rethrow_exception(state.exception);
+  }
+  return skippedKeys;
+}
+
+
+template <class K, class T>
+void DigraphScheduler<K, T>::enqueue(RunState& state, Index index) const
+{
+  if (state.queued[index]) {
+    return;
+  }
+  state.queued[index] = true;
+  state.ready.push_back(index);
+  state.readyCondition.notify_one();
+}
+
+
+template <class K, class T>
+void DigraphScheduler<K, T>::work(RunState& state, const Action& action)
+{
+  std::vector<Index> readyDependents;
+  std::unique_lock<std::mutex> lock(state.mutex);
+  while (true) {
+    state.readyCondition.wait(lock, [&state](){return !state.ready.empty() || state.closing;});
+    if (state.ready.empty()) {
+      return;
+    }
+
+    auto index = state.ready.front();
+    state.ready.pop_front();
+    state.dispatched[index] = true;
+    bool forced = state.forced[index];
+    ++state.inFlight;
+    lock.unlock();
+
+    bool failed = false;
+    try {
+      action(*graph.nodes[index].data, forced);
+    }
+    catch (...) {
+      failed = true;
+      lock.lock();
+      if (!state.exception) {
+        state.exception = std::current_exception();
+      }
+      state.stopDispatching = true;
+      state.ready.clear();
+      lock.unlock();
+    }
+
+    // only the last finished dependency makes the node ready
+    readyDependents.clear();
+    if (!failed) {
+      for (auto dependent: dependents[index]) {
+        if (state.pendingCounts[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          readyDependents.push_back(dependent);
+        }
+      }
+    }
+
+    lock.lock();
+    --state.inFlight;
+    ++state.finished;
+    if (!state.stopDispatching) {
+      for (auto dependent: readyDependents) {
+        enqueue(state, dependent);
+      }
+    }
+    state.doneCondition.notify_one();
+  }
+}
+
+
+template <class K, class T>
+bool DigraphScheduler<K, T>::isDone(const RunState& state) const
+{
+  return state.finished == waitCounts.size()
+      || (state.inFlight == 0 && state.ready.empty());
+}
+
+} // namespace cppps
+
+#endif // DIGRAPHSCHEDULER_H
@@ -0,0 +1,114 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef EPOCHDOMAIN_H
+#define EPOCHDOMAIN_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+
+namespace cppps {
+
+/**
+ * @brief Epoch-based memory reclamation domain.
+ *
+ * Readers enter the domain before dereferencing a shared
+ * pointer and leave it when done; entering is wait-free.
+ * Writers unlink an object first and then retire it with
+ * a deleter. The deleter is called once all the readers that
+ * could have seen the object have left the domain, i.e. when
+ * the global epoch has been advanced twice since the retirement.
+ *
+ * Reader counters are striped over separate cache lines
+ * to limit the contention between reading threads.
+ */
+class EpochDomain
+{
+public:
+  using Deleter = std::function<void()>;
+
+  class Guard
+  {
+  public:
+    Guard(Guard&& rhs) noexcept;
+    Guard(const Guard&) = delete;
+    Guard& operator=(const Guard&) = delete;
+    Guard& operator=(Guard&&) = delete;
+    ~Guard();
+
+  private:
+    friend class EpochDomain;
+    Guard(std::atomic<int64_t>* counter);
+    std::atomic<int64_t>* counter;
+  };
+
+  EpochDomain() = default;
+  ~EpochDomain();
+
+  EpochDomain(const EpochDomain&) = delete;
+  EpochDomain& operator=(const EpochDomain&) = delete;
+
+  /**
+   * @brief Enter the domain (read-side critical section)
+   * @return Guard leaving the domain on destruction
+   */
+  [[nodiscard]] Guard enter();
+
+  /**
+   * @brief Schedule an unlinked object for deletion
+   * @param deleter Function releasing the object
+   */
+  void retire(Deleter deleter);
+
+  /**
+   * @brief Try to advance the epoch and call the deleters
+   * of the objects no reader can access anymore. Never blocks
+   * on the readers.
+   */
+  void reclaim();
+
+  /**
+   * @brief Wait until all retired objects are released.
+   *
+   * Must not be called from within a read-side critical section.
+   */
+  void synchronize();
+
+  /**
+   * @brief Count the objects waiting for reclamation
+   */
+  [[nodiscard]] size_t getRetiredCount() const;
+
+private:
+  static constexpr size_t STRIPES = 16;
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
+  struct alignas(CACHE_LINE_SIZE) Stripe
+  {
+    std::array<std::atomic<int64_t>, 2> readers {};
+  };
+
+  struct Retired
+  {
+    uint64_t epoch;
+    Deleter deleter;
+  };
+
+  std::array<Stripe, STRIPES> stripes;
+  std::atomic<uint64_t> epoch {0};
+  std::list<Retired> retired;
+  mutable std::mutex retireMutex;
+
+private:
+  bool tryAdvance();
+  std::list<Retired> takeReclaimable();
+};
+
+} // namespace cppps
+
+#endif // EPOCHDOMAIN_H
@@ -0,0 +1,114 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef EPOLLREACTOR_H
+#define EPOLLREACTOR_H
+
+#include "cppps/dl/IReactor.h"
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace cppps {
+
+/**
+ * @brief Linux implementation of the IReactor based on epoll.
+ *
+ * Timers are kept in a heap and bound the epoll_wait() timeout,
+ * while posted tasks and stop requests wake the loop up through
+ * an eventfd. The stop() method is async-signal-safe.
+ */
+class EpollReactor: public IReactor
+{
+public:
+  EpollReactor();
+  ~EpollReactor() override;
+
+  EpollReactor(const EpollReactor&) = delete;
+  EpollReactor& operator=(const EpollReactor&) = delete;
+
+  /**
+   * @brief Run the event loop in the calling thread until stop() is called
+   *
+   * Returns at once if stop() has been called before. The stop request
+   * is consumed on return, so the loop can be run again.
+   *
+   * @return Exit code passed to stop()
+   */
+  int run();
+
+  /**
+   * @brief Make run() return (can be called from a signal handler)
+   * @param exitCode Value to be returned by run()
+   */
+  void stop(int exitCode = 0);
+
+  /**
+   * @brief Check if any descriptor, timer or task is registered
+   */
+  bool hasSources() const;
+
+  /**
+   * @brief Drop all registered descriptors, timers and tasks
+   *
+   * Used to release the callbacks before their code gets unloaded.
+   */
+  void clear();
+
+  // IReactor
+  void addFd(int fd, Events events, FdCallback callback) override;
+  void modifyFd(int fd, Events events) override;
+  bool removeFd(int fd) override;
+  TimerId addTimer(Duration delay, Callback callback, Duration period = Duration(0)) override;
+  bool cancelTimer(TimerId id) override;
+  void post(Callback task) override;
+  bool isReactorThread() const override;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Timer
+  {
+    Clock::time_point deadline;
+    Duration period;
+    std::shared_ptr<Callback> callback;
+  };
+
+  struct Deadline
+  {
+    Clock::time_point deadline;
+    TimerId id;
+    bool operator>(const Deadline& other) const {return deadline > other.deadline;}
+  };
+
+  int epollFd {-1};
+  int wakeFd {-1};
+  std::atomic_bool stopRequested {false};
+  std::atomic<int> exitCode {0};
+  std::atomic<std::thread::id> reactorThread {};
+
+  mutable std::mutex mutex;
+  std::map<int, std::shared_ptr<FdCallback>> fdCallbacks;
+  std::map<TimerId, Timer> timers;
+  std::priority_queue<Deadline, std::vector<Deadline>, std::greater<>> deadlines;
+  TimerId nextTimerId {1};
+  std::list<Callback> tasks;
+
+private:
+  void wakeUp();
+  int getTimeout();
+  void runTasks();
+  void runTimers();
+  void dispatch(int fd, uint32_t epollEvents);
+};
+
+} // namespace cppps
+
+#endif // EPOLLREACTOR_H
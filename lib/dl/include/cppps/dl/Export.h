@@ -5,7 +5,11 @@
 #ifndef EXPORT_H
 #define EXPORT_H
 
-#ifdef CPPPS_DL_USE_BOOST
+#include "cppps/dl/PluginDescriptor.h"
+
+#if defined(CPPPS_STATIC_PLUGINS)
+# include "cppps/dl/StaticPlugins.h"
+#elif defined(CPPPS_DL_USE_BOOST)
 # include <boost/dll/alias.hpp>
 #endif
 
@@ -31,17 +35,57 @@
   /**/
 #endif
 
-#ifndef CPPPS_DL_USE_BOOST
+// the descriptor is filled from the plugin compile definitions
+#ifdef PLUGIN_NAME
+#  define CPPPS_PLUGIN_INFO_NAME PLUGIN_NAME
+#else
+#  define CPPPS_PLUGIN_INFO_NAME ""
+#endif
+#ifdef PLUGIN_VERSION
+#  define CPPPS_PLUGIN_INFO_VERSION PLUGIN_VERSION
+#else
+#  define CPPPS_PLUGIN_INFO_VERSION ""
+#endif
+#ifdef PLUGIN_PROVIDES
+#  define CPPPS_PLUGIN_INFO_PROVIDES PLUGIN_PROVIDES
+#else
+#  define CPPPS_PLUGIN_INFO_PROVIDES ""
+#endif
+#ifdef PLUGIN_CONSUMES
+#  define CPPPS_PLUGIN_INFO_CONSUMES PLUGIN_CONSUMES
+#else
+#  define CPPPS_PLUGIN_INFO_CONSUMES ""
+#endif
+
+#define CPPPS_EXPORT_PLUGIN_DESCRIPTOR()                                          \
+  CPPPS_PLUGIN_DESCRIPTOR(CPPPS_PLUGIN_INFO_NAME, CPPPS_PLUGIN_INFO_VERSION,      \
+                          CPPPS_PLUGIN_INFO_PROVIDES, CPPPS_PLUGIN_INFO_CONSUMES) \
+  /**/
+
+#if defined(CPPPS_STATIC_PLUGINS)
+// the plugin is linked into the program, Application collects it
+// from the table of static plugins instead of loading a library
+#define CPPPS_EXPORT_PLUGIN(CLASS_NAME)                         \
+  namespace {                                                   \
+  cppps::IPluginUPtr cpppsMakePlugin() {                        \
+    return std::unique_ptr<cppps::IPlugin>(new CLASS_NAME());}  \
+  CPPPS_STATIC_PLUGIN_ENTRY(cpppsMakePlugin)                    \
+  }                                                             \
+  CPPPS_EXPORT_PLUGIN_DESCRIPTOR()                              \
+  /**/
+#elif !defined(CPPPS_DL_USE_BOOST)
 #define CPPPS_EXPORT_PLUGIN(CLASS_NAME)                         \
   cppps::IPluginUPtr _makePlugin() {                            \
     return std::unique_ptr<cppps::IPlugin>(new CLASS_NAME());}  \
   CPPPS_DL_EXPORT_FN(_makePlugin, make_plugin)                  \
+  CPPPS_EXPORT_PLUGIN_DESCRIPTOR()                              \
   /**/
 #else
 #define CPPPS_EXPORT_PLUGIN(CLASS_NAME)                         \
   cppps::IPluginUPtr _makePlugin() {                            \
     return std::unique_ptr<cppps::IPlugin>(new CLASS_NAME());}  \
   BOOST_DLL_ALIAS(_makePlugin, make_plugin)                     \
+  CPPPS_EXPORT_PLUGIN_DESCRIPTOR()                              \
   /**/
 #endif
 
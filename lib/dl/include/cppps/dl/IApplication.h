@@ -5,19 +5,110 @@
 #ifndef IAPPLICATION_H
 #define IAPPLICATION_H
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <string>
 
 namespace cppps {
 
+class ResourceRegistry;
+class IReactor;
+
 class IApplication
 {
 public:
 
   using MainLoop = std::function<int()>;
+  using OnPluginStoppedHook = std::function<void(const std::string& pluginName)>;
+  using HookId = uint64_t;
+  using OnExitFlushHook = std::function<void()>;
 
   virtual ~IApplication() = default;
+  static constexpr int ANY_CPU = -1;
+
   virtual void setMainLoop(const MainLoop& loop) = 0;
+
+  /**
+   * @brief Add a named loop run on a dedicated thread
+   *
+   * The loops are started after all the plugins have been started.
+   * Each loop should return once its plugin is stopped; the loop
+   * threads are joined in the order of addition.
+   *
+   * @param name Unique loop name, also used as the thread name
+   * @param loop Loop returning an exit code
+   * @param cpu CPU the thread is pinned to, ANY_CPU for no pinning
+   */
+  virtual void addMainLoop(const std::string& name, const MainLoop& loop, int cpu = ANY_CPU) = 0;
   virtual void quit() = 0;
+  virtual const ResourceRegistry& getResourceRegistry() const = 0;
+
+  /**
+   * @brief Register a hook called right after a plugin has been stopped
+   *
+   * Lets the service providers release the resources held
+   * on behalf of the stopped plugin (timers, tasks etc.).
+   *
+   * @return Id of the hook to be passed to removeOnPluginStoppedHook()
+   */
+  virtual HookId addOnPluginStoppedHook(const OnPluginStoppedHook& hook) = 0;
+
+  /**
+   * @brief Remove a plugin-stopped hook
+   *
+   * Should be called by the plugin registering the hook when it is
+   * unloaded, e.g. replaced by a reload.
+   */
+  virtual void removeOnPluginStoppedHook(HookId id) = 0;
+
+  /**
+   * @brief Set the time the plugin's stop() is expected to finish in
+   *
+   * Exceeding the deadline does not interrupt the plugin,
+   * but gets reported as soon as the deadline passes.
+   * Overrides AppInfo::stopDeadline for the given plugin.
+   */
+  virtual void setStopDeadline(const std::string& pluginName,
+                               std::chrono::milliseconds deadline) = 0;
+
+  /**
+   * @brief Register a hook flushing buffered output (logs, metrics etc.)
+   *
+   * The hooks are called on the fast exit (see AppInfo::fastExit),
+   * after all the plugins have been stopped. The plugins are
+   * neither unloaded nor destroyed then.
+   */
+  virtual void addOnExitFlushHook(const OnExitFlushHook& hook) = 0;
+
+  /**
+   * @brief Load a plugin library and add the plugin to the running application
+   *
+   * The plugin is initialized against the resources of the running
+   * plugins and started; the running plugins are not touched again.
+   */
+  virtual void loadPlugin(const std::string& pluginPath) = 0;
+
+  /**
+   * @brief Replace a running plugin with the one loaded from the library
+   *
+   * The plugin of the same name and all the plugins consuming its
+   * resources are stopped; the new plugin is prepared and initialized
+   * and started with the same consumer instances, which are not unloaded
+   * (see IPlugin). The replaced plugin is unloaded once the new one runs.
+   * Unrelated plugins keep running.
+   * As dlopen() returns an already loaded library for the same path,
+   * the new version should be installed under a new file name.
+   */
+  virtual void reloadPlugin(const std::string& pluginPath) = 0;
+
+  /**
+   * @brief Get the event loop shared by the plugins
+   *
+   * The reactor runs as the main loop when no plugin sets one,
+   * otherwise it runs on a separate thread.
+   */
+  virtual IReactor& getReactor() = 0;
 
 };
 
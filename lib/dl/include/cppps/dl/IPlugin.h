@@ -27,6 +27,15 @@ using SubmitConsumer = std::function<void(std::string_view, const ResourceConsum
  * This is the interface required to be implemented
  * by all cppps plugins.
  *
+ * The plugin is prepared once, then its resources are submitted,
+ * it is initialized, started, stopped and finally unloaded. When a
+ * provider of the plugin (direct or not) is reloaded, the plugin is
+ * stopped and the same instance is initialized again: submitProviders(),
+ * submitConsumers(), initialize() and start() are called once more,
+ * without unload() or prepare() in between. A plugin consuming resources
+ * therefore has to release in stop() what initialize() acquires (or make
+ * initialize() replace it), and its consumers have to accept being
+ * called again with the resources of the new provider.
  */
 class IPlugin
 {
@@ -0,0 +1,85 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef IREACTOR_H
+#define IREACTOR_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace cppps {
+
+/**
+ * @brief Event loop shared by the plugins.
+ *
+ * Plugins register file descriptors, timers and tasks instead
+ * of running their own loops and threads. All callbacks are
+ * called on the reactor thread; the registration methods
+ * can be called from any thread.
+ */
+class IReactor
+{
+public:
+  using Events = uint32_t;
+  using FdCallback = std::function<void(Events events)>;
+  using Callback = std::function<void()>;
+  using TimerId = uint64_t;
+  using Duration = std::chrono::nanoseconds;
+
+  static constexpr Events READABLE = 0x1;
+  static constexpr Events WRITABLE = 0x2;
+  static constexpr Events FAILURE = 0x4;
+  static constexpr Events HANGUP = 0x8;
+
+  virtual ~IReactor() = default;
+
+  /**
+   * @brief Watch a file descriptor
+   * @param fd File descriptor (not owned by the reactor)
+   * @param events READABLE and/or WRITABLE; FAILURE and HANGUP are always reported
+   * @param callback Callback called with the ready events
+   */
+  virtual void addFd(int fd, Events events, FdCallback callback) = 0;
+
+  /**
+   * @brief Change the events watched for a registered descriptor
+   */
+  virtual void modifyFd(int fd, Events events) = 0;
+
+  /**
+   * @brief Stop watching a file descriptor
+   * @return false if the descriptor was not registered
+   */
+  virtual bool removeFd(int fd) = 0;
+
+  /**
+   * @brief Schedule a timer
+   * @param delay Time after which the callback is called
+   * @param callback Timer callback
+   * @param period Period of a repeating timer, 0 for a one-shot timer
+   * @return Timer identifier
+   */
+  virtual TimerId addTimer(Duration delay, Callback callback, Duration period = Duration(0)) = 0;
+
+  /**
+   * @brief Cancel a timer
+   * @return false if the timer has already expired or has been cancelled
+   */
+  virtual bool cancelTimer(TimerId id) = 0;
+
+  /**
+   * @brief Wake the reactor up and run the task on the reactor thread
+   */
+  virtual void post(Callback task) = 0;
+
+  /**
+   * @brief Check if the calling thread runs the reactor
+   */
+  virtual bool isReactorThread() const = 0;
+};
+
+} // namespace cppps
+
+#endif // IREACTOR_H
@@ -0,0 +1,139 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef PLUGINBUNDLE_H
+#define PLUGINBUNDLE_H
+
+#include "cppps/dl/PluginDescriptor.h"
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace cppps {
+
+constexpr uint32_t PLUGIN_BUNDLE_FORMAT_VERSION = 1;
+
+constexpr char PLUGIN_BUNDLE_MAGIC[] = "CPPPSPB";
+
+/**
+ * @brief Separates the bundle path and the image name in the path
+ * of a bundled plugin, e.g. "/opt/app/plugins.bundle!/libfoo.so".
+ */
+constexpr std::string_view PLUGIN_BUNDLE_ENTRY_SEPARATOR = "!/";
+
+/**
+ * @brief Single file holding many plugin libraries.
+ *
+ * Starts with an index of the plugin images (file name, offset, size and
+ * the plugin descriptor, if the plugin has one), followed by the images
+ * aligned to pages. Deploying a bundle instead of a plugin directory
+ * replaces opening, examining and scanning one file per plugin with
+ * reading one index.
+ *
+ * The bundle is mapped into memory. A plugin image is loaded by copying
+ * it into an anonymous memory file (memfd_create) and opening that file
+ * with the dynamic linker, so the image is never extracted to the disk;
+ * bundled plugins are then loaded through DlopenPluginLoader like files
+ * (Linux only). A bundled plugin cannot be the DT_NEEDED dependency of
+ * another library, as the dynamic linker cannot find it by its name.
+ */
+class PluginBundle
+{
+public:
+  using Paths = std::list<std::string>;
+
+  struct Entry
+  {
+    std::string name; // image file name, e.g. libfoo.so.1.2
+    uint64_t offset;
+    uint64_t size;
+    std::optional<PluginInfo> info;
+  };
+
+  using Entries = std::vector<Entry>;
+
+  /**
+   * @brief Map the bundle and read its index
+   *
+   * Throws PluginBundleException if the file cannot be read
+   * or is not a valid bundle.
+   */
+  explicit PluginBundle(const std::string& path);
+  ~PluginBundle();
+
+  PluginBundle(const PluginBundle&) = delete;
+  PluginBundle& operator=(const PluginBundle&) = delete;
+
+  const std::string& getPath() const;
+  const Entries& getEntries() const;
+
+  /**
+   * @return Entry of the image with given file name or nullptr
+   */
+  const Entry* findEntry(std::string_view name) const;
+
+  /**
+   * @brief Get the mapped image bytes
+   */
+  std::string_view getImage(const Entry& entry) const;
+
+  /**
+   * @brief Copy the image into a new anonymous memory file
+   *
+   * Throws PluginBundleException if the memory file cannot be created.
+   *
+   * @return File descriptor to be closed by the caller, the image
+   * can be loaded from "/proc/self/fd/<descriptor>"
+   */
+  int openImage(const Entry& entry) const;
+
+  /**
+   * @brief Create the bundle from the plugin files
+   *
+   * The image names are the file names, so they have to be unique. The
+   * plugin descriptors are read from the files (ELF platforms only).
+   * Throws PluginBundleException on errors.
+   */
+  static void write(const std::string& path, const Paths& pluginPaths);
+
+private:
+  std::string path;
+  Entries entries;
+  const char* data {nullptr};
+  uint64_t size {0};
+};
+
+/**
+ * @brief Make the path of a bundled plugin image
+ */
+inline std::string makeBundleEntryPath(std::string_view bundlePath, std::string_view name)
+{
+  return std::string(bundlePath) + std::string(PLUGIN_BUNDLE_ENTRY_SEPARATOR) + std::string(name);
+}
+
+/**
+ * @brief Split the path of a bundled plugin into the bundle path and the image name
+ * @return Nothing if the path does not point into a bundle
+ */
+inline std::optional<std::pair<std::string, std::string>> splitBundleEntryPath(std::string_view path)
+{
+  auto separator = path.rfind(PLUGIN_BUNDLE_ENTRY_SEPARATOR);
+  if (separator == std::string_view::npos || separator == 0) {
+    return std::nullopt;
+  }
+  auto name = path.substr(separator + PLUGIN_BUNDLE_ENTRY_SEPARATOR.size());
+  if (name.empty() || name.find('/') != std::string_view::npos) {
+    return std::nullopt;
+  }
+  return std::make_pair(std::string(path.substr(0, separator)), std::string(name));
+}
+
+} // namespace cppps
+
+#endif // PLUGINBUNDLE_H
@@ -5,6 +5,7 @@
 #ifndef PLUGINCOLLECTOR_H
 #define PLUGINCOLLECTOR_H
 
+#include <functional>
 #include <list>
 #include <string>
 
@@ -16,22 +17,47 @@ public:
 
   using Paths = std::list<std::string>;
   using Directories = std::list<std::string>;
+  using Bundles = std::list<std::string>;
   using Extensions = std::list<std::string>;
+  using Filter = std::function<bool(const std::string& pluginName)>;
 
   virtual ~PluginCollector() = default;
   void addPluginExtension(std::string_view extension);
   void addDirectory(std::string_view dir);
   void addDirectories(const Directories& dirs);
+
+  /**
+   * @brief Collect the plugins from the bundle (see PluginBundle) next to the directories
+   *
+   * The bundled plugins are collected as "<bundle path>!/<image name>" paths,
+   * loaded by DlopenPluginLoader. Missing bundles are skipped like missing
+   * directories; ignored on Windows.
+   */
+  void addBundle(std::string_view bundlePath);
+  void addBundles(const Bundles& bundles);
   void enablePathEnvVariable(std::string_view name);
   void enableFileEnvVariable(std::string_view name);
+
+  /**
+   * @brief Set the predicate selecting the collected plugins
+   *
+   * The plugin name is the name from the plugin descriptor (see
+   * readPluginDescriptors()), i.e. the name reported by the plugin. For
+   * the files without the descriptor it is the file name without the "lib"
+   * prefix, the extension and the version suffix, e.g. "foo" for libfoo.so.1.2.
+   */
+  void setFilter(const Filter& filter);
+
   Paths collectPlugins();
 
 
 private:
   std::list<std::string> extensions;
   std::list<std::string> dirs;
+  std::list<std::string> bundles;
   std::string pathEnvVariableName;
   std::string fileEnvVariableName;
+  Filter filter {nullptr};
 
 private:
   void appendEnvVariableFiles(Paths& paths);
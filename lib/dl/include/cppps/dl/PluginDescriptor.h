@@ -0,0 +1,141 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef PLUGINDESCRIPTOR_H
+#define PLUGINDESCRIPTOR_H
+
+#include "cppps/dl/Section.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cppps {
+
+/**
+ * @brief Version of the plugin interface, increased on incompatible changes
+ */
+constexpr uint32_t PLUGIN_ABI_VERSION = 1;
+
+constexpr char PLUGIN_DESCRIPTOR_MAGIC[] = "CPPPSPD";
+
+/**
+ * @brief Plugin description stored in the plugin file.
+ *
+ * CPPPS_EXPORT_PLUGIN places the descriptor in the "cppps_plugin_info"
+ * section (ELF platforms only), so it can be read from the file without
+ * loading the library, see readPluginDescriptors(). The descriptor holds
+ * no pointers and needs no relocations; the key lists are comma-separated.
+ * The size is a multiple of the alignment, so the descriptors of statically
+ * linked plugins form an array without gaps.
+ */
+struct alignas(32) PluginDescriptor
+{
+  char magic[8] {};
+  uint32_t abiVersion {PLUGIN_ABI_VERSION};
+  uint32_t size {sizeof(PluginDescriptor)};
+  char name[64] {};
+  char version[48] {};
+  char providedKeys[256] {};
+  char consumedKeys[256] {};
+};
+
+/**
+ * @brief Plugin description read from the plugin file
+ */
+struct PluginInfo
+{
+  std::string name;
+  std::string version;
+  std::vector<std::string> providedKeys;
+  std::vector<std::string> consumedKeys;
+  uint32_t abiVersion {0};
+};
+
+using PluginInfos = std::vector<PluginInfo>;
+
+/**
+ * @brief Build the plugin descriptor
+ *
+ * Too long fields throw, which fails the compilation
+ * of a constexpr descriptor.
+ *
+ * @param providedKeys Comma-separated keys of the provided resources
+ * @param consumedKeys Comma-separated keys of the consumed resources
+ */
+constexpr PluginDescriptor makePluginDescriptor(std::string_view name,
+                                                std::string_view version,
+                                                std::string_view providedKeys,
+                                                std::string_view consumedKeys);
+
+/**
+ * @brief Read the descriptors of the plugins from the file
+ *
+ * Throws PluginDescriptorException if the file cannot be read
+ * or is not a valid ELF file.
+ *
+ * @param path Plugin library or executable path
+ * @return Descriptors found in the file (none for the plugins
+ * built without the descriptor)
+ */
+PluginInfos readPluginDescriptors(const std::string& path);
+
+/**
+ * @brief Convert the descriptor to the plugin description
+ */
+PluginInfo toPluginInfo(const PluginDescriptor& descriptor);
+
+// ---------
+
+namespace detail {
+
+template <size_t N>
+constexpr void copyDescriptorField(char (&field)[N], std::string_view value)
+{
+  if (value.size() >= N) {
+    throw std::length_error("Plugin descriptor field too long: " + std::string(value));
+  }
+  for (size_t i = 0; i < value.size(); ++i) {
+    field[i] = value[i];
+  }
+}
+
+} // namespace detail
+
+constexpr PluginDescriptor makePluginDescriptor(std::string_view name,
+                                                std::string_view version,
+                                                std::string_view providedKeys,
+                                                std::string_view consumedKeys)
+{
+  PluginDescriptor descriptor;
+  detail::copyDescriptorField(descriptor.magic, PLUGIN_DESCRIPTOR_MAGIC);
+  detail::copyDescriptorField(descriptor.name, name);
+  detail::copyDescriptorField(descriptor.version, version);
+  detail::copyDescriptorField(descriptor.providedKeys, providedKeys);
+  detail::copyDescriptorField(descriptor.consumedKeys, consumedKeys);
+  return descriptor;
+}
+
+} // namespace cppps
+
+#ifdef CPPPS_SECTIONS_SUPPORTED
+#  define CPPPS_PLUGIN_DESCRIPTOR_IN_SECTION
+#endif
+
+#ifdef CPPPS_PLUGIN_DESCRIPTOR_IN_SECTION
+#define CPPPS_PLUGIN_DESCRIPTOR(NAME, VERSION, PROVIDED_KEYS, CONSUMED_KEYS)         \
+  namespace {                                                                        \
+  CPPPS_IN_SECTION("cppps_plugin_info")                                              \
+  constexpr cppps::PluginDescriptor cpppsPluginDescriptor                            \
+    = cppps::makePluginDescriptor(NAME, VERSION, PROVIDED_KEYS, CONSUMED_KEYS);      \
+  }                                                                                  \
+  /**/
+#else
+#define CPPPS_PLUGIN_DESCRIPTOR(NAME, VERSION, PROVIDED_KEYS, CONSUMED_KEYS)
+#endif
+
+#endif // PLUGINDESCRIPTOR_H
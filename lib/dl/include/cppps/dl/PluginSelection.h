@@ -0,0 +1,70 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef PLUGINSELECTION_H
+#define PLUGINSELECTION_H
+
+#include <list>
+#include <string>
+#include <string_view>
+
+namespace cppps {
+
+/**
+ * @brief Include and exclude patterns of the plugins to be loaded.
+ *
+ * The patterns are read from the --plugins and --disable-plugins
+ * options before the plugins are loaded, i.e. before the command line
+ * is parsed by the Cli. The options may be given on the command line
+ * or in the config file (-c, --config); the command line overrides
+ * the config file. Each option takes a comma-separated list of plugin
+ * names, '*' and '?' wildcards are allowed.
+ *
+ * The static plugins and the plugins with the descriptor are matched
+ * by the name they report (IPlugin::getName()), the plugin files without
+ * the descriptor by the file name (see PluginCollector::setFilter()).
+ *
+ * A plugin is selected if it matches any include pattern (or there
+ * are none) and does not match any exclude pattern.
+ */
+class PluginSelection
+{
+public:
+  using Patterns = std::list<std::string>;
+
+  static constexpr auto PLUGINS_OPTION = "--plugins";
+  static constexpr auto DISABLE_PLUGINS_OPTION = "--disable-plugins";
+
+  /**
+   * @brief Read the patterns from the command line and the config file
+   */
+  void parse(int argc, char** argv);
+
+  /**
+   * @param patterns Comma-separated plugin name patterns
+   */
+  void addIncludePatterns(std::string_view patterns);
+  void addExcludePatterns(std::string_view patterns);
+
+  const Patterns& getIncludePatterns() const {return includePatterns;}
+  const Patterns& getExcludePatterns() const {return excludePatterns;}
+
+  /**
+   * @brief Check if any pattern has been given
+   */
+  bool isRestricted() const;
+
+  bool isSelected(std::string_view pluginName) const;
+
+private:
+  Patterns includePatterns;
+  Patterns excludePatterns;
+
+private:
+  void parseConfigFile(const std::string& path);
+};
+
+} // namespace cppps
+
+#endif // PLUGINSELECTION_H
@@ -6,7 +6,13 @@
 #define PLUGINSYSTEM_H
 
 #include "cppps/dl/IPlugin.h"
+#include "cppps/dl/ResourceRegistry.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <list>
+#include <map>
+#include <set>
 
 namespace cppps {
 
@@ -28,11 +34,92 @@ class IApplication;
  * d) an exception is thrown when there is at leas one
  * circular dependency.
  *
+ * All provided resources are published in the resource
+ * registry, which stays available until the plugins are unloaded.
+ *
+ * Plugins added after the initialization stage are initialized
+ * incrementally: the next initialize() call resolves them against
+ * the resources of the already initialized plugins, and the next
+ * start() call starts only them. The running plugins are not
+ * touched again.
+ *
+ * A running plugin can be replaced with its new version by reload().
+ * Only the plugin and the plugins consuming its resources (directly
+ * or not) are stopped, like in stop(); the new plugin is prepared, and
+ * it is initialized and started with the same consumer instances, which
+ * are not unloaded nor prepared again (the re-initialization contract
+ * is described in IPlugin). The replaced plugin is unloaded
+ * once the new subgraph is running. When the new subgraph fails, it is
+ * stopped, the new plugin is unloaded and the consumers are initialized
+ * and started again with the replaced plugin before the error is thrown.
+ * The replaced instances are destroyed when the system is unloaded,
+ * as the resources published earlier may still refer to their code.
+ *
+ * The plugin-stopped hooks are called after every IPlugin::stop()
+ * call with the name of the stopped plugin.
+ *
+ * Every plugin can be given a stop (drain) deadline. Plugins
+ * exceeding their deadlines are reported by the deadline hook
+ * as soon as the deadline passes and in the stop report.
+ *
+ * In the parallel life-cycle mode the plugins are started
+ * concurrently once all their providers are started, and stopped
+ * concurrently once all their consumers are stopped (the hooks
+ * may then be called from many threads). When the phase timeout
+ * passes, the start phase throws LifecycleTimeoutException without
+ * starting the remaining plugins; like the plugins whose start() has
+ * thrown, they are started by the next start() call. The stop phase
+ * stops the remaining plugins at once, without waiting for their
+ * consumers.
+ * The calls in progress are always waited for, as the plugin code
+ * may be unloaded right after the phase.
+ *
+ * The initialization of every plugin is timed. The startup report
+ * lays the measured durations over the dependency graph, showing
+ * the critical path (the chain of providers bounding the boot time),
+ * the slack of every plugin (how much its initialization could grow
+ * without delaying the boot) and the boot time under unlimited
+ * parallelism.
+ *
  */
 class PluginSystem
 {
 public:
   using LoadedPlugins = std::list<IPluginDPtr>;
+  using OnPluginStoppedHook = std::function<void(const std::string& pluginName)>;
+  using HookId = uint64_t;
+  using OnStopDeadlineExceededHook = std::function<void(const std::string& pluginName,
+                                                        std::chrono::milliseconds deadline)>;
+
+  struct StopReportEntry
+  {
+    std::string pluginName;
+    std::chrono::milliseconds duration;
+    std::chrono::milliseconds deadline; // 0 for no deadline
+    bool deadlineExceeded;
+    bool forced; // stopped after the phase timeout, before its consumers
+  };
+
+  using StopReport = std::list<StopReportEntry>;
+
+  struct StartupReportEntry
+  {
+    std::string pluginName;
+    std::chrono::microseconds duration; // initialization with the resource exchange
+    std::chrono::microseconds earliestStart; // under unlimited parallelism
+    std::chrono::microseconds slack;
+    bool critical;
+  };
+
+  struct StartupReport
+  {
+    std::list<StartupReportEntry> plugins; // in the dependency order
+    std::list<std::string> criticalPath; // providers first
+    std::chrono::microseconds serialTime; // sum of the durations
+    std::chrono::microseconds parallelTime; // length of the critical path
+  };
+
+  enum class LifecycleMode {SERIAL, PARALLEL};
 
   PluginSystem();
   void addPlugin(IPluginDPtr&& plugin);
@@ -43,9 +130,59 @@ public:
   void stop();
   void unload();
 
+  /**
+   * @brief Replace a running plugin and restart its dependent plugins
+   * @param plugin New plugin instance; must have the same name as the replaced one
+   * @param cli Command line handle passed to the new plugin's prepare()
+   * @param app Application handle passed to the new plugin's prepare()
+   */
+  void reload(IPluginDPtr&& plugin, const ICliPtr& cli, IApplication& app);
+
+  const ResourceRegistry& getResourceRegistry() const;
+  HookId addOnPluginStoppedHook(const OnPluginStoppedHook& hook);
+  void removeOnPluginStoppedHook(HookId id);
+
+  void setDefaultStopDeadline(std::chrono::milliseconds deadline);
+  void setStopDeadline(const std::string& pluginName, std::chrono::milliseconds deadline);
+  void setOnStopDeadlineExceededHook(const OnStopDeadlineExceededHook& hook);
+  const StopReport& getStopReport() const;
+
+  /**
+   * @brief Compute the critical path of the initialized plugins
+   * @return Report based on the last measured initialization durations
+   */
+  StartupReport getStartupReport() const;
+
+  void setLifecycleMode(LifecycleMode mode);
+  void setPhaseTimeout(std::chrono::milliseconds timeout);
+
 private:
   LoadedPlugins uninitializedPlugins;
   LoadedPlugins initializedPlugins;
+  LoadedPlugins replacedPlugins;
+  ResourceRegistry resourceRegistry;
+  std::map<HookId, OnPluginStoppedHook> onPluginStoppedHooks;
+  HookId nextHookId {1};
+  std::chrono::milliseconds defaultStopDeadline {0};
+  std::map<std::string, std::chrono::milliseconds> stopDeadlines;
+  OnStopDeadlineExceededHook onStopDeadlineExceededHook {nullptr};
+  StopReport stopReport;
+  LifecycleMode lifecycleMode {LifecycleMode::SERIAL};
+  std::chrono::milliseconds phaseTimeout {0};
+  std::map<std::string /*plugin name*/,
+           std::set<std::string> /*provider plugin names*/> pluginProviders;
+  std::map<std::string /*resource key*/,
+           std::string /*plugin name*/> providerOrigins;
+  ResourceRegistry::Resources resources;
+  std::map<std::string /*plugin name*/, std::chrono::microseconds> initDurations;
+  size_t startedPluginCount {0};
+
+private:
+  std::chrono::milliseconds getStopDeadline(const std::string& pluginName) const;
+  std::set<std::string> getDependentPlugins(const std::string& pluginName);
+  void initializePlugins(LoadedPlugins& plugins);
+  void stopPlugins(LoadedPlugins& plugins);
+  void withdrawResources(const std::set<std::string>& pluginNames);
 };
 
 } // namespace cppps
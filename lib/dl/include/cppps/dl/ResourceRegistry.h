@@ -0,0 +1,181 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef RESOURCEREGISTRY_H
+#define RESOURCEREGISTRY_H
+
+#include "cppps/dl/Resource.h"
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+
+namespace cppps {
+
+class NoSuchResourceException: public std::runtime_error {
+  using runtime_error::runtime_error;
+};
+
+/**
+ * @brief Registry of the resources provided by initialized plugins.
+ *
+ * The registry is filled by the PluginSystem and can be queried
+ * from any thread after the boot. Every update publishes a new
+ * immutable snapshot through an atomic pointer, so the lookups
+ * never take a lock. Replaced snapshots are kept alive until
+ * the registry is cleared (updates are rare and happen mostly
+ * during the initialization).
+ */
+class ResourceRegistry
+{
+public:
+  using Resources = std::map<std::string, Resource, std::less<>>;
+
+  template <class T>
+  class Handle;
+
+  ResourceRegistry();
+  ~ResourceRegistry();
+
+  ResourceRegistry(const ResourceRegistry&) = delete;
+  ResourceRegistry& operator=(const ResourceRegistry&) = delete;
+
+  /**
+   * @brief Publish new or replace existing resources.
+   *
+   * The lookups started before this call keep using
+   * the previous snapshot.
+   *
+   * @param resources Resources to be merged with the current snapshot
+   */
+  void publish(const Resources& resources);
+
+  /**
+   * @brief Withdraw the resources with given keys.
+   *
+   * The lookups started before this call keep using
+   * the previous snapshot.
+   *
+   * @param keys Keys of the resources to be removed from the current snapshot
+   */
+  void remove(const std::set<std::string>& keys);
+
+  /**
+   * @brief Remove all resources and free the retained snapshots.
+   *
+   * Must not be called concurrently with the lookups.
+   */
+  void clear();
+
+  /**
+   * @brief Check if a resource with given key has been published
+   * @param key Resource key
+   */
+  [[nodiscard]] bool contains(std::string_view key) const;
+
+  /**
+   * @brief Get a copy of the resource value
+   * @param key Resource key
+   * @return Resource value converted to T
+   */
+  template <class T>
+  [[nodiscard]] T get(std::string_view key) const;
+
+  /**
+   * @brief Get a caching handle to the resource.
+   *
+   * The handle is meant to be owned by a single thread.
+   * It converts the resource once and resolves it again
+   * only when the registry has been updated.
+   *
+   * @param key Resource key
+   */
+  template <class T>
+  [[nodiscard]] Handle<T> getHandle(std::string_view key) const;
+
+  /**
+   * @brief Get the number of published snapshots
+   * @return Version incremented on every update
+   */
+  [[nodiscard]] uint64_t getVersion() const;
+
+private:
+  struct Snapshot
+  {
+    uint64_t version;
+    Resources resources;
+  };
+
+  std::atomic<const Snapshot*> snapshot {nullptr};
+  std::list<Snapshot> snapshots;
+  std::mutex updateMutex;
+
+private:
+  const Resource& find(std::string_view key) const;
+};
+
+template <class T>
+class ResourceRegistry::Handle
+{
+public:
+  Handle(const ResourceRegistry& registry, std::string_view key);
+
+  /**
+   * @brief Get the cached resource value.
+   * @return Resource value, resolved again if the registry has changed
+   */
+  const T& get();
+
+  const T& operator*() {return get();}
+  const T* operator->() {return &get();}
+
+private:
+  const ResourceRegistry* registry;
+  std::string key;
+  uint64_t version {0};
+  std::optional<T> value;
+};
+
+// ----------
+
+template <class T>
+T ResourceRegistry::get(std::string_view key) const
+{
+  return find(key).as<T>();
+}
+
+template <class T>
+ResourceRegistry::Handle<T> ResourceRegistry::getHandle(std::string_view key) const
+{
+  return Handle<T>(*this, key);
+}
+
+template <class T>
+ResourceRegistry::Handle<T>::Handle(const ResourceRegistry& registry, std::string_view key)
+  : registry{&registry}
+  , key{key}
+{
+  // empty
+}
+
+template <class T>
+const T& ResourceRegistry::Handle<T>::get()
+{
+  auto currentVersion = registry->getVersion();
+  if (!value || version != currentVersion) {
+    value = registry->get<T>(key);
+    version = currentVersion;
+  }
+  return *value;
+}
+
+} // namespace cppps
+
+#endif // RESOURCEREGISTRY_H
@@ -0,0 +1,25 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef SECTION_H
+#define SECTION_H
+
+// CPPPS_IN_SECTION places a variable in the named section (ELF platforms
+// only). The variable is kept even if unreferenced: "used" for the
+// compiler and "retain" for the linker garbage collection (--gc-sections),
+// where the compiler supports it.
+#if defined(__ELF__)
+#  define CPPPS_SECTIONS_SUPPORTED
+#  if defined(__has_attribute)
+#    if __has_attribute(retain)
+#      define CPPPS_SECTION_RETAIN retain,
+#    endif
+#  endif
+#  ifndef CPPPS_SECTION_RETAIN
+#    define CPPPS_SECTION_RETAIN
+#  endif
+#  define CPPPS_IN_SECTION(NAME) __attribute__((used, CPPPS_SECTION_RETAIN section(NAME)))
+#endif
+
+#endif // SECTION_H
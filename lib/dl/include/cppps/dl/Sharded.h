@@ -0,0 +1,227 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef SHARDED_H
+#define SHARDED_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace cppps {
+
+enum class ShardSelection {
+  CPU,    // shard of the CPU the calling thread runs on
+  THREAD  // shard assigned to the calling thread
+};
+
+/**
+ * @brief Get the number of CPUs available to the process
+ * @return Default number of shards (at least 1)
+ */
+size_t getDefaultShardCount();
+
+/**
+ * @brief Get the shard index hint for the calling thread
+ * @param selection Shard selection policy
+ * @return Index hint, not limited to any number of shards
+ */
+size_t getShardHint(ShardSelection selection);
+
+/**
+ * @brief Resource split into per-CPU (or per-thread) instances.
+ *
+ * The factory is called once per shard and every shard
+ * occupies separate cache lines, so counters and caches
+ * kept in the shards do not suffer from false sharing.
+ * Consumers use local() to get the shard of their current
+ * CPU or thread and aggregate() to combine all shards.
+ *
+ * Note that a thread may migrate or share a CPU with other
+ * threads, so the shard objects still have to be thread-safe
+ * (e.g. use atomics); sharding only reduces the contention.
+ *
+ * Example provider:
+ * @code
+ * hits = cppps::makeSharded<Counter>([](size_t){return Counter{};});
+ * submitProvider("hits", [this](){return hits;});
+ * @endcode
+ *
+ * Example consumer:
+ * @code
+ * hits->local().value.fetch_add(1, std::memory_order_relaxed);
+ * auto total = hits->aggregate(0, [](int sum, const Counter& counter){
+ *   return sum + counter.value.load();
+ * });
+ * @endcode
+ */
+template <class T>
+class Sharded
+{
+public:
+
+  /**
+   * @param factory Functor creating the shard of given index: T(size_t)
+   * @param shards Number of shards
+   * @param selection Shard selection policy used by local()
+   */
+  template <class Factory>
+  explicit Sharded(Factory&& factory,
+                   size_t shards = getDefaultShardCount(),
+                   ShardSelection selection = ShardSelection::CPU);
+  ~Sharded();
+
+  Sharded(const Sharded&) = delete;
+  Sharded& operator=(const Sharded&) = delete;
+
+  /**
+   * @brief Get the shard of the calling thread
+   */
+  T& local();
+
+  /**
+   * @brief Get the shard of given index (e.g. a worker index)
+   */
+  T& at(size_t shard);
+  const T& at(size_t shard) const;
+
+  [[nodiscard]] size_t size() const {return count;}
+
+  template <class F>
+  void forEach(F&& function);
+
+  template <class F>
+  void forEach(F&& function) const;
+
+  /**
+   * @brief Combine all shards
+   * @param init Initial value
+   * @param fold Functor: R(R accumulator, const T& shard)
+   * @return Aggregated value
+   */
+  template <class R, class F>
+  R aggregate(R init, F&& fold) const;
+
+private:
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
+  struct alignas(CACHE_LINE_SIZE) Slot
+  {
+    T value;
+  };
+
+  Slot* slots {nullptr};
+  size_t count {0};
+  ShardSelection selection;
+
+private:
+  void release(size_t constructed);
+};
+
+template <class T>
+using ShardedPtr = std::shared_ptr<Sharded<T>>;
+
+template <class T, class Factory>
+ShardedPtr<T> makeSharded(Factory&& factory,
+                          size_t shards = getDefaultShardCount(),
+                          ShardSelection selection = ShardSelection::CPU)
+{
+  return std::make_shared<Sharded<T>>(std::forward<Factory>(factory), shards, selection);
+}
+
+// ----------
+
+template <class T>
+template <class Factory>
+Sharded<T>::Sharded(Factory&& factory, size_t shards, ShardSelection selection)
+  : selection{selection}
+{
+  if (shards == 0) {
+    throw std::invalid_argument("The number of shards must be greater than 0");
+  }
+
+  slots = static_cast<Slot*>(::operator new(sizeof(Slot) * shards,
+                                            std::align_val_t(alignof(Slot))));
+  try {
+    for (; count < shards; ++count) {
+      new (&slots[count]) Slot{factory(count)};
+    }
+  }
+  catch (...) {
+    release(count);
+    throw;
+  }
+}
+
+template <class T>
+Sharded<T>::~Sharded()
+{
+  release(count);
+}
+
+template <class T>
+T& Sharded<T>::local()
+{
+  return slots[getShardHint(selection) % count].value;
+}
+
+template <class T>
+T& Sharded<T>::at(size_t shard)
+{
+  if (shard >= count) {
+    throw std::out_of_range("Shard index out of range: " + std::to_string(shard));
+  }
+  return slots[shard].value;
+}
+
+template <class T>
+const T& Sharded<T>::at(size_t shard) const
+{
+  return const_cast<Sharded<T>*>(this)->at(shard);
+}
+
+template <class T>
+template <class F>
+void Sharded<T>::forEach(F&& function)
+{
+  for (size_t i = 0; i < count; ++i) {
+    function(slots[i].value);
+  }
+}
+
+template <class T>
+template <class F>
+void Sharded<T>::forEach(F&& function) const
+{
+  for (size_t i = 0; i < count; ++i) {
+    function(static_cast<const T&>(slots[i].value));
+  }
+}
+
+template <class T>
+template <class R, class F>
+R Sharded<T>::aggregate(R init, F&& fold) const
+{
+  for (size_t i = 0; i < count; ++i) {
+    init = fold(std::move(init), static_cast<const T&>(slots[i].value));
+  }
+  return init;
+}
+
+template <class T>
+void Sharded<T>::release(size_t constructed)
+{
+  for (size_t i = 0; i < constructed; ++i) {
+    slots[i].~Slot();
+  }
+  ::operator delete(slots, std::align_val_t(alignof(Slot)));
+  slots = nullptr;
+}
+
+} // namespace cppps
+
+#endif // SHARDED_H
@@ -0,0 +1,236 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef STATICDIGRAPH_H
+#define STATICDIGRAPH_H
+
+#include "cppps/dl/Digraph.h"
+#include "cppps/dl/exceptions.h"
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace cppps {
+
+/**
+ * @brief Fixed-capacity directed graph usable in constant expressions.
+ *
+ * A compile-time counterpart of the Digraph for the builds knowing
+ * the whole plugin set up front: nodes are identified by string keys
+ * (e.g. plugin names), the edges are kept in an adjacency matrix,
+ * and no dynamic allocation or std::function is involved. Errors
+ * (duplicated or unknown keys, a full graph, cycles) are reported by
+ * exceptions, which turns them into compilation errors in a constant
+ * expression.
+ *
+ * The topological order follows the Digraph convention: the heads
+ * of the edges precede their tails.
+ *
+ * Example:
+ * @code
+ * constexpr auto initOrder = []{
+ *   cppps::StaticDigraph<3> graph;
+ *   graph.addNode("logger");
+ *   graph.addNode("database");
+ *   graph.addNode("api");
+ *   graph.addEdge("database", "logger");
+ *   graph.addEdge("api", "database");
+ *   return graph.topologicalSort(); // fails to compile on a cycle
+ * }();
+ * static_assert(initOrder[0] == "logger");
+ * @endcode
+ */
+template <size_t N>
+class StaticDigraph
+{
+public:
+  using Index = size_t;
+
+  static constexpr Index NO_INDEX = static_cast<Index>(-1);
+
+  /**
+   * @brief Node keys in the topological order
+   */
+  class SortedKeys
+  {
+  public:
+    constexpr size_t size() const {return count;}
+    constexpr std::string_view operator[](size_t i) const {return keys[i];}
+    constexpr const std::string_view* begin() const {return keys.data();}
+    constexpr const std::string_view* end() const {return keys.data() + count;}
+
+  private:
+    friend class StaticDigraph;
+
+    std::array<std::string_view, N> keys {};
+    size_t count {0};
+  };
+
+  constexpr StaticDigraph() = default;
+
+  /**
+   * @brief Add new node to the graph
+   * @param key Node identifier; the viewed string has to outlive the graph
+   * @return Node index
+   */
+  constexpr Index addNode(std::string_view key);
+
+  /**
+   * @brief Add an edge between nodes identified by given keys
+   * @param startNode Tail node
+   * @param endNode Head node
+   */
+  constexpr void addEdge(std::string_view startNode, std::string_view endNode);
+
+  /**
+   * @brief Find the node index
+   * @return Node index or NO_INDEX
+   */
+  constexpr Index find(std::string_view key) const;
+
+  constexpr bool hasEdge(std::string_view startNode, std::string_view endNode) const;
+
+  /**
+   * @brief Check if the graph has at least one cycle
+   */
+  constexpr bool hasCycles() const;
+
+  /**
+   * @brief Perform topological sort of the nodes
+   *
+   * Throws CircularDependencyException if the graph has cycles.
+   *
+   * @return Node keys, heads before their tails
+   */
+  constexpr SortedKeys topologicalSort() const;
+
+  constexpr size_t size() const {return nodeCount;}
+  static constexpr size_t capacity() {return N;}
+
+private:
+  std::array<std::string_view, N> keys {};
+  std::array<std::array<bool, N>, N> edges {};
+  size_t nodeCount {0};
+
+private:
+  constexpr Index getIndex(std::string_view key) const;
+  constexpr size_t sortNodes(std::array<Index, N>& sortedIndices) const;
+};
+
+// ---------
+
+template <size_t N>
+constexpr typename StaticDigraph<N>::Index StaticDigraph<N>::addNode(std::string_view key)
+{
+  if (find(key) != NO_INDEX) {
+    throw DuplicatedNodeException("Directed Graph error: the node with key "
+                                  + std::string(key) + " already exists");
+  }
+  if (nodeCount == N) {
+    throw std::length_error("Static graph capacity exceeded");
+  }
+  keys[nodeCount] = key;
+  return nodeCount++;
+}
+
+
+template <size_t N>
+constexpr void StaticDigraph<N>::addEdge(std::string_view startNode, std::string_view endNode)
+{
+  auto startIndex = getIndex(startNode);
+  auto endIndex = getIndex(endNode);
+  edges[startIndex][endIndex] = true;
+}
+
+
+template <size_t N>
+constexpr typename StaticDigraph<N>::Index StaticDigraph<N>::find(std::string_view key) const
+{
+  for (Index i = 0; i < nodeCount; ++i) {
+    if (keys[i] == key) {
+      return i;
+    }
+  }
+  return NO_INDEX;
+}
+
+
+template <size_t N>
+constexpr bool StaticDigraph<N>::hasEdge(std::string_view startNode,
+                                         std::string_view endNode) const
+{
+  return edges[getIndex(startNode)][getIndex(endNode)];
+}
+
+
+template <size_t N>
+constexpr bool StaticDigraph<N>::hasCycles() const
+{
+  std::array<Index, N> sortedIndices {};
+  return sortNodes(sortedIndices) != nodeCount;
+}
+
+
+template <size_t N>
+constexpr typename StaticDigraph<N>::SortedKeys StaticDigraph<N>::topologicalSort() const
+{
+  std::array<Index, N> sortedIndices {};
+  auto sortedCount = sortNodes(sortedIndices);
+  if (sortedCount != nodeCount) {
+    throw CircularDependencyException("Circular dependencies have been found in the static graph");
+  }
+
+  SortedKeys sortedKeys;
+  for (size_t i = 0; i < sortedCount; ++i) {
+    sortedKeys.keys[i] = keys[sortedIndices[i]];
+  }
+  sortedKeys.count = sortedCount;
+  return sortedKeys;
+}
+
+
+template <size_t N>
+constexpr typename StaticDigraph<N>::Index StaticDigraph<N>::getIndex(std::string_view key) const
+{
+  auto index = find(key);
+  if (index == NO_INDEX) {
+    throw NoSuchNodeException("No such node: " + std::string(key));
+  }
+  return index;
+}
+
+
+template <size_t N>
+constexpr size_t StaticDigraph<N>::sortNodes(std::array<Index, N>& sortedIndices) const
+{
+  // Kahn's algorithm: a node is placed after all its heads,
+  // the nodes of a cycle are never placed
+  std::array<size_t, N> pendingCounts {};
+  size_t sortedCount = 0;
+  for (Index i = 0; i < nodeCount; ++i) {
+    for (Index j = 0; j < nodeCount; ++j) {
+      pendingCounts[i] += edges[i][j] ? 1 : 0;
+    }
+    if (pendingCounts[i] == 0) {
+      sortedIndices[sortedCount++] = i;
+    }
+  }
+
+  for (size_t next = 0; next < sortedCount; ++next) {
+    auto headIndex = sortedIndices[next];
+    for (Index i = 0; i < nodeCount; ++i) {
+      if (edges[i][headIndex] && --pendingCounts[i] == 0) {
+        sortedIndices[sortedCount++] = i;
+      }
+    }
+  }
+  return sortedCount;
+}
+
+} // namespace cppps
+
+#endif // STATICDIGRAPH_H
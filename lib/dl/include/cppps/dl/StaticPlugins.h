@@ -0,0 +1,66 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef STATICPLUGINS_H
+#define STATICPLUGINS_H
+
+#include "cppps/dl/IPlugin.h"
+#include "cppps/dl/Section.h"
+
+#include <vector>
+
+// the linker collects the entries of the "cppps_plugins" section
+// and defines the __start_/__stop_ symbols bounding them
+#ifdef CPPPS_SECTIONS_SUPPORTED
+#  define CPPPS_STATIC_PLUGINS_IN_SECTION
+#endif
+
+namespace cppps {
+
+using MakePluginFn = IPluginUPtr (*)();
+
+/**
+ * @brief Entry of the table of the statically linked plugins
+ */
+struct StaticPluginEntry
+{
+  MakePluginFn makePlugin;
+};
+
+using StaticPluginEntries = std::vector<StaticPluginEntry>;
+
+/**
+ * @brief Register a statically linked plugin at runtime
+ *
+ * Used by CPPPS_EXPORT_PLUGIN on the platforms without
+ * the linker-generated table of plugins.
+ *
+ * @return Always true, so the call can initialize a static variable
+ */
+bool registerStaticPlugin(const StaticPluginEntry& entry);
+
+/**
+ * @brief Get the plugins linked into the program
+ *
+ * The plugins exported by CPPPS_EXPORT_PLUGIN with CPPPS_STATIC_PLUGINS
+ * defined; on ELF platforms they are read from the table collected by
+ * the linker, followed by the plugins added with registerStaticPlugin().
+ */
+StaticPluginEntries getStaticPlugins();
+
+} // namespace cppps
+
+#ifdef CPPPS_STATIC_PLUGINS_IN_SECTION
+#define CPPPS_STATIC_PLUGIN_ENTRY(FN_NAME)                                    \
+  CPPPS_IN_SECTION("cppps_plugins")                                           \
+  const cppps::StaticPluginEntry cpppsStaticPluginEntry {&FN_NAME};           \
+  /**/
+#else
+#define CPPPS_STATIC_PLUGIN_ENTRY(FN_NAME)                                    \
+  const bool cpppsStaticPluginRegistered                                      \
+    = cppps::registerStaticPlugin(cppps::StaticPluginEntry{&FN_NAME});        \
+  /**/
+#endif
+
+#endif // STATICPLUGINS_H
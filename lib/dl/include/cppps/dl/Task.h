@@ -0,0 +1,392 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef TASK_H
+#define TASK_H
+
+#if !defined(__cpp_impl_coroutine)
+#  error "cppps/dl/Task.h requires C++20 coroutines support"
+#endif
+
+#include "cppps/dl/IReactor.h"
+#include "cppps/dl/ResourceRegistry.h"
+
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace cppps {
+
+template <class T = void>
+class Task;
+
+namespace detail {
+
+struct TaskPromiseBase
+{
+  struct FinalAwaiter
+  {
+    bool await_ready() noexcept {return false;}
+
+    template <class Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+    {
+      auto continuation = handle.promise().continuation;
+      return continuation ? continuation : std::noop_coroutine();
+    }
+
+    void await_resume() noexcept {}
+  };
+
+  std::suspend_always initial_suspend() noexcept {return {};}
+  FinalAwaiter final_suspend() noexcept {return {};}
+  void unhandled_exception() {exception = std::current_exception();}
+
+  std::coroutine_handle<> continuation {nullptr};
+  std::exception_ptr exception {nullptr};
+};
+
+template <class T>
+struct TaskPromise: TaskPromiseBase
+{
+  Task<T> get_return_object();
+  void return_value(T result) {value.emplace(std::move(result));}
+
+  T getResult()
+  {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+    return std::move(*value);
+  }
+
+  std::optional<T> value;
+};
+
+template <>
+struct TaskPromise<void>: TaskPromiseBase
+{
+  Task<void> get_return_object();
+  void return_void() {}
+
+  void getResult()
+  {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+};
+
+struct DetachedTask
+{
+  struct promise_type
+  {
+    DetachedTask get_return_object() {return {};}
+    std::suspend_never initial_suspend() noexcept {return {};}
+    std::suspend_never final_suspend() noexcept {return {};}
+    void return_void() {}
+    void unhandled_exception() {std::terminate();}
+  };
+};
+
+} // namespace detail
+
+/**
+ * @brief Lazily started coroutine returning T.
+ *
+ * The coroutine starts when awaited and resumes its awaiting
+ * coroutine when done; exceptions are passed to the awaiting
+ * coroutine. Use spawn() to start a top-level task on a reactor.
+ *
+ * Example plugin code:
+ * @code
+ * cppps::Task<> poll(IReactor& reactor, int fd)
+ * {
+ *   while (true) {
+ *     co_await cppps::readable(reactor, fd);
+ *     handleInput(fd);
+ *     co_await cppps::sleepFor(reactor, std::chrono::milliseconds(100));
+ *   }
+ * }
+ *
+ * void start() override {
+ *   cppps::spawn(app->getReactor(), poll(app->getReactor(), fd));
+ * }
+ * @endcode
+ */
+template <class T>
+class Task
+{
+public:
+  using promise_type = detail::TaskPromise<T>;
+  using Handle = std::coroutine_handle<promise_type>;
+
+  explicit Task(Handle handle): handle{handle} {}
+  Task(Task&& other) noexcept: handle{std::exchange(other.handle, nullptr)} {}
+  Task& operator=(Task&& other) noexcept;
+  ~Task();
+
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+
+  bool await_ready() const noexcept {return !handle || handle.done();}
+  std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept;
+  T await_resume() {return handle.promise().getResult();}
+
+private:
+  Handle handle {nullptr};
+};
+
+using TaskErrorHandler = std::function<void(std::exception_ptr)>;
+
+/**
+ * @brief Start a detached task on the reactor thread
+ * @param reactor Reactor running the task
+ * @param task Task to be started
+ * @param onError Exception handler; when empty, the exception is
+ * rethrown from the reactor loop
+ */
+void spawn(IReactor& reactor, Task<> task, TaskErrorHandler onError = nullptr);
+
+/**
+ * @brief Suspend the coroutine for given time
+ */
+auto sleepFor(IReactor& reactor, IReactor::Duration duration);
+
+/**
+ * @brief Suspend the coroutine until the descriptor is readable
+ * @return Ready events
+ */
+auto readable(IReactor& reactor, int fd);
+
+/**
+ * @brief Suspend the coroutine until the descriptor is writable
+ * @return Ready events
+ */
+auto writable(IReactor& reactor, int fd);
+
+/**
+ * @brief Continue the coroutine on the reactor thread
+ */
+auto resumeOn(IReactor& reactor);
+
+/**
+ * @brief Suspend the coroutine until the resource is published
+ * @param reactor Reactor checking the registry
+ * @param registry Resource registry, e.g. IApplication::getResourceRegistry()
+ * @param key Resource key
+ * @param interval Registry check interval
+ * @return Resource value converted to T
+ */
+template <class T>
+auto resource(IReactor& reactor, const ResourceRegistry& registry, std::string_view key,
+              IReactor::Duration interval = std::chrono::milliseconds(10));
+
+// ----------
+
+template <class T>
+Task<T> detail::TaskPromise<T>::get_return_object()
+{
+  return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline Task<void> detail::TaskPromise<void>::get_return_object()
+{
+  return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+template <class T>
+Task<T>& Task<T>::operator=(Task&& other) noexcept
+{
+  if (this != &other) {
+    if (handle) {
+      handle.destroy();
+    }
+    handle = std::exchange(other.handle, nullptr);
+  }
+  return *this;
+}
+
+template <class T>
+Task<T>::~Task()
+{
+  if (handle) {
+    handle.destroy();
+  }
+}
+
+template <class T>
+std::coroutine_handle<> Task<T>::await_suspend(std::coroutine_handle<> awaiting) noexcept
+{
+  handle.promise().continuation = awaiting;
+  return handle;
+}
+
+namespace detail {
+
+inline DetachedTask runDetached(Task<> task, TaskErrorHandler onError, IReactor& reactor)
+{
+  try {
+    co_await task;
+  }
+  catch (...) {
+    auto exception = std::current_exception();
+    if (onError) {
+      onError(exception);
+    }
+    else {
+      reactor.post([exception](){std::rethrow_exception(exception);});
+    }
+  }
+}
+
+class TimerAwaiter
+{
+public:
+  TimerAwaiter(IReactor& reactor, IReactor::Duration duration)
+    : reactor{reactor}, duration{duration} {}
+
+  bool await_ready() const noexcept {return false;}
+
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    reactor.addTimer(duration, [handle](){handle.resume();});
+  }
+
+  void await_resume() const noexcept {}
+
+private:
+  IReactor& reactor;
+  IReactor::Duration duration;
+};
+
+class FdAwaiter
+{
+public:
+  FdAwaiter(IReactor& reactor, int fd, IReactor::Events events)
+    : reactor{reactor}, fd{fd}, events{events} {}
+
+  bool await_ready() const noexcept {return false;}
+
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    reactor.addFd(fd, events, [this, handle](IReactor::Events readyEvents){
+      reactor.removeFd(fd);
+      events = readyEvents;
+      handle.resume();
+    });
+  }
+
+  IReactor::Events await_resume() const noexcept {return events;}
+
+private:
+  IReactor& reactor;
+  int fd;
+  IReactor::Events events;
+};
+
+class PostAwaiter
+{
+public:
+  explicit PostAwaiter(IReactor& reactor): reactor{reactor} {}
+
+  bool await_ready() const noexcept {return reactor.isReactorThread();}
+
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    reactor.post([handle](){handle.resume();});
+  }
+
+  void await_resume() const noexcept {}
+
+private:
+  IReactor& reactor;
+};
+
+template <class T>
+class ResourceAwaiter
+{
+public:
+  ResourceAwaiter(IReactor& reactor, const ResourceRegistry& registry,
+                  std::string_view key, IReactor::Duration interval)
+    : reactor{reactor}, registry{registry}, key{key}, interval{interval} {}
+
+  bool await_ready() const {return registry.contains(key);}
+
+  void await_suspend(std::coroutine_handle<> handle)
+  {
+    this->handle = handle;
+    poll();
+  }
+
+  T await_resume() const {return registry.get<T>(key);}
+
+private:
+  void poll()
+  {
+    // one-shot timers: the timer may fire before addTimer() returns,
+    // and each one resumes the coroutine or arms the next one, never both
+    reactor.addTimer(interval, [this](){
+      if (registry.contains(key)) {
+        handle.resume();
+      }
+      else {
+        poll();
+      }
+    });
+  }
+
+  IReactor& reactor;
+  const ResourceRegistry& registry;
+  std::string key;
+  IReactor::Duration interval;
+  std::coroutine_handle<> handle;
+};
+
+} // namespace detail
+
+inline void spawn(IReactor& reactor, Task<> task, TaskErrorHandler onError)
+{
+  // std::function requires a copyable target
+  auto sharedTask = std::make_shared<Task<>>(std::move(task));
+  reactor.post([&reactor, sharedTask, onError = std::move(onError)](){
+    detail::runDetached(std::move(*sharedTask), onError, reactor);
+  });
+}
+
+inline auto sleepFor(IReactor& reactor, IReactor::Duration duration)
+{
+  return detail::TimerAwaiter(reactor, duration);
+}
+
+inline auto readable(IReactor& reactor, int fd)
+{
+  return detail::FdAwaiter(reactor, fd, IReactor::READABLE);
+}
+
+inline auto writable(IReactor& reactor, int fd)
+{
+  return detail::FdAwaiter(reactor, fd, IReactor::WRITABLE);
+}
+
+inline auto resumeOn(IReactor& reactor)
+{
+  return detail::PostAwaiter(reactor);
+}
+
+template <class T>
+auto resource(IReactor& reactor, const ResourceRegistry& registry, std::string_view key,
+              IReactor::Duration interval)
+{
+  return detail::ResourceAwaiter<T>(reactor, registry, key, interval);
+}
+
+} // namespace cppps
+
+#endif // TASK_H
@@ -0,0 +1,175 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef VERSIONED_H
+#define VERSIONED_H
+
+#include "cppps/dl/EpochDomain.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace cppps {
+
+/**
+ * @brief Hot-swappable resource value.
+ *
+ * A provider shares the VersionedPtr<T> as a regular resource
+ * and publishes new immutable versions of the value whenever
+ * it changes (e.g. a reloaded routing table). Consumers read
+ * the current version through a wait-free pointer load, without
+ * any locks. The replaced versions are released with the
+ * epoch-based reclamation once no reader can access them.
+ *
+ * Example provider:
+ * @code
+ * routes = cppps::makeVersioned<RoutingTable>(loadRoutes());
+ * submitProvider("routes", [this](){return routes;});
+ * // ...
+ * routes->publish(loadRoutes());
+ * @endcode
+ *
+ * Example consumer:
+ * @code
+ * routes = resource.as<cppps::VersionedPtr<RoutingTable>>();
+ * // ...
+ * auto table = routes->read();
+ * table->lookup(address);
+ * @endcode
+ */
+template <class T>
+class Versioned
+{
+private:
+  struct Node
+  {
+    T value;
+    uint64_t version;
+  };
+
+public:
+
+  /**
+   * @brief Pinned version of the value.
+   *
+   * The value remains valid as long as the guard
+   * exists; guards should be short-lived, since
+   * they hold back the reclamation.
+   */
+  class ReadGuard
+  {
+  public:
+    const T& operator*() const {return node->value;}
+    const T* operator->() const {return &node->value;}
+    uint64_t getVersion() const {return node->version;}
+
+  private:
+    friend class Versioned;
+    ReadGuard(EpochDomain::Guard&& guard, const Node* node)
+      : guard{std::move(guard)}, node{node} {}
+
+    EpochDomain::Guard guard;
+    const Node* node;
+  };
+
+  template <class... Args>
+  explicit Versioned(Args&&... args);
+  ~Versioned();
+
+  Versioned(const Versioned&) = delete;
+  Versioned& operator=(const Versioned&) = delete;
+
+  /**
+   * @brief Read the current version of the value
+   * @return Guard pinning the current version
+   */
+  [[nodiscard]] ReadGuard read() const;
+
+  /**
+   * @brief Publish new version of the value
+   * @param value New immutable value
+   * @return Version number of the published value
+   */
+  uint64_t publish(T value);
+
+  /**
+   * @brief Get the current version number
+   * @return Version number, starting with 1 for the initial value
+   */
+  [[nodiscard]] uint64_t getVersion() const;
+
+  /**
+   * @brief Release the replaced versions that are no
+   * longer read; called automatically on every publication.
+   */
+  void reclaim();
+
+private:
+  mutable EpochDomain domain;
+  std::atomic<const Node*> current;
+  std::mutex publishMutex;
+};
+
+template <class T>
+using VersionedPtr = std::shared_ptr<Versioned<T>>;
+
+template <class T, class... Args>
+VersionedPtr<T> makeVersioned(Args&&... args)
+{
+  return std::make_shared<Versioned<T>>(std::forward<Args>(args)...);
+}
+
+// ----------
+
+template <class T>
+template <class... Args>
+Versioned<T>::Versioned(Args&&... args)
+  : current{new Node{T(std::forward<Args>(args)...), 1}}
+{
+  // empty
+}
+
+template <class T>
+Versioned<T>::~Versioned()
+{
+  // the retired versions are released by the domain
+  delete current.load();
+}
+
+template <class T>
+typename Versioned<T>::ReadGuard Versioned<T>::read() const
+{
+  auto guard = domain.enter();
+  return ReadGuard(std::move(guard), current.load(std::memory_order_seq_cst));
+}
+
+template <class T>
+uint64_t Versioned<T>::publish(T value)
+{
+  std::lock_guard<std::mutex> lock(publishMutex);
+  auto version = current.load(std::memory_order_relaxed)->version + 1;
+  const auto* previous = current.exchange(new Node{std::move(value), version},
+                                          std::memory_order_seq_cst);
+  domain.retire([previous](){delete previous;});
+  domain.reclaim();
+  return version;
+}
+
+template <class T>
+uint64_t Versioned<T>::getVersion() const
+{
+  return current.load(std::memory_order_acquire)->version;
+}
+
+template <class T>
+void Versioned<T>::reclaim()
+{
+  domain.reclaim();
+}
+
+} // namespace cppps
+
+#endif // VERSIONED_H
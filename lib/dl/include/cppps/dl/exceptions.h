@@ -23,6 +23,30 @@ class CircularDependencyException: public std::runtime_error {
   using runtime_error::runtime_error;
 };
 
+class DuplicatedPluginException: public std::runtime_error {
+  using runtime_error::runtime_error;
+};
+
+class PluginReloadException: public std::runtime_error {
+  using runtime_error::runtime_error;
+};
+
+class ReactorException: public std::runtime_error {
+  using runtime_error::runtime_error;
+};
+
+class LifecycleTimeoutException: public std::runtime_error {
+  using runtime_error::runtime_error;
+};
+
+class PluginDescriptorException: public std::runtime_error {
+  using runtime_error::runtime_error;
+};
+
+class PluginBundleException: public std::runtime_error {
+  using runtime_error::runtime_error;
+};
+
 } // namespace cppps
 
 
@@ -4,25 +4,110 @@
 
 #include "cppps/dl/Application.h"
 #include "cppps/dl/Cli.h"
+#include "cppps/dl/exceptions.h"
+#include "cppps/dl/StaticPlugins.h"
+#include "HelpCache.h"
+#include "PluginLoadingPipeline.h"
 #include "PluginLoader.h"
+#include "PluginPrefetcher.h"
 
 #include "OsUtils.h"
 
+#include <cstdio>
 #include <filesystem>
 #include <iostream>
 #include <csignal>
 #include <functional>
+#include <iomanip>
+#include <thread>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 using namespace cppps;
 
 namespace  {
 
 static bool instanceExists {false};
+
+#ifdef _WIN32
 std::function<void(int)> quitApp {[](int){}};
 
 void signalHandler(int signum) {
     quitApp(signum);
 }
+#else
+// self-pipe: the handler only wakes the signal thread up,
+// which quits the application outside the signal context
+constexpr unsigned char STOP_SIGNAL_THREAD = 0;
+int signalPipe[2] = {-1, -1};
+
+void signalHandler(int signum) {
+  auto savedErrno = errno;
+  auto signal = static_cast<unsigned char>(signum);
+  [[maybe_unused]] auto result = write(signalPipe[1], &signal, sizeof(signal));
+  errno = savedErrno;
+}
+#endif
+
+void printStartupReport(std::ostream& stream, const PluginSystem::StartupReport& report)
+{
+  auto toMs = [](std::chrono::microseconds duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+  };
+
+  auto flags = stream.flags();
+  auto precision = stream.precision();
+  stream << std::fixed << std::setprecision(3)
+         << "Startup report (ms):\n"
+         << std::left << std::setw(32) << "  plugin" << std::right
+         << std::setw(12) << "init" << std::setw(12) << "start at"
+         << std::setw(12) << "slack" << "\n";
+  for (const auto& entry: report.plugins) {
+    stream << (entry.critical ? "* " : "  ")
+           << std::left << std::setw(30) << entry.pluginName << std::right
+           << std::setw(12) << toMs(entry.duration)
+           << std::setw(12) << toMs(entry.earliestStart)
+           << std::setw(12) << toMs(entry.slack) << "\n";
+  }
+
+  stream << "Critical path:";
+  for (const auto& name: report.criticalPath) {
+    stream << " " << name;
+  }
+  stream << "\nSerial initialization time: " << toMs(report.serialTime) << " ms"
+         << "\nUnlimited parallelism time: " << toMs(report.parallelTime) << " ms"
+         << std::endl;
+  stream.flags(flags);
+  stream.precision(precision);
+}
+
+void printLoadReport(std::ostream& stream, const Application::LoadReport& report)
+{
+  auto flags = stream.flags();
+  auto precision = stream.precision();
+  stream << std::fixed << std::setprecision(3)
+         << "Load report:\n"
+         << std::setw(12) << "load (ms)" << std::setw(14) << "major faults"
+         << "  plugin file\n";
+  for (const auto& entry: report) {
+    stream << std::setw(12) << std::chrono::duration<double, std::milli>(entry.duration).count()
+           << std::setw(14);
+    if (entry.majorFaults >= 0) {
+      stream << entry.majorFaults;
+    }
+    else {
+      stream << "-";
+    }
+    stream << "  " << entry.pluginPath << "\n";
+  }
+  stream << std::flush;
+  stream.flags(flags);
+  stream.precision(precision);
+}
 
 }
 
@@ -32,14 +117,32 @@ Application::Application(const AppInfo& appInfo)
   if (instanceExists) {
     throw std::runtime_error("Threre can be only one instance of the Application class");
   }
+#ifndef _WIN32
+  reactor = std::make_unique<EpollReactor>();
+#endif
+  pluginSystem.setDefaultStopDeadline(appInfo.stopDeadline);
+  if (appInfo.parallelLifecycle) {
+    pluginSystem.setLifecycleMode(PluginSystem::LifecycleMode::PARALLEL);
+    pluginSystem.setPhaseTimeout(appInfo.phaseTimeout);
+  }
+  pluginSystem.setOnStopDeadlineExceededHook([](const auto& pluginName, auto deadline){
+    std::cerr << "Plugin '" << pluginName << "' has exceeded its stop deadline ("
+              << deadline.count() << " ms)" << std::endl;
+  });
   instanceExists = true;
 }
 
 Application::~Application()
 {
+  // the signal thread may be quitting the application
+  restoreInterruptHandler();
   if (!quitCalled) {
     quit();
   }
+  // release the callbacks before the plugin code is unloaded
+  if (reactor) {
+    reactor->clear();
+  }
   pluginSystem.unload();
   instanceExists = false;
 }
@@ -49,6 +152,11 @@ void Application::setPluginDirectories(const Application::Directories& dirs)
   pluginDirs = dirs;
 }
 
+void Application::setPluginBundles(const Application::Bundles& bundles)
+{
+  pluginBundles = bundles;
+}
+
 std::string Application::getAppDirPath()
 {
   return cppps::getProgramDirPath();
@@ -61,24 +169,108 @@ void Application::preloadPlugin(IPluginUPtr&& plugin)
   preloadedPlugins.push_back(std::move(preloadedPlugin));
 }
 
+void Application::addPlugin(IPluginUPtr&& plugin)
+{
+  IPluginDPtr addedPlugin(plugin.get(), [](auto* obj){delete obj;});
+  plugin.release();
+  addStartedPlugin(std::move(addedPlugin));
+}
+
+void Application::loadPlugin(const std::string& pluginPath)
+{
+  auto loader = cppps::getPluginLoader();
+  addStartedPlugin(loader.load(pluginPath));
+}
+
+void Application::replacePlugin(IPluginUPtr&& plugin)
+{
+  IPluginDPtr newPlugin(plugin.get(), [](auto* obj){delete obj;});
+  plugin.release();
+  replaceStartedPlugin(std::move(newPlugin));
+}
+
+void Application::reloadPlugin(const std::string& pluginPath)
+{
+  auto loader = cppps::getPluginLoader();
+  replaceStartedPlugin(loader.load(pluginPath));
+}
+
 int Application::exec(int argc, char** argv)
 {
+  // answered without loading the plugins
+  auto earlyRequest = Cli::findEarlyRequest(argc, argv);
+  if (earlyRequest == Cli::EarlyRequest::VERSION) {
+    std::cout << appInfo.appVersionPage << '\n';
+    return EXIT_SUCCESS;
+  }
+
   if (appInfo.interruptable) {
     setupInterruptHandler();
   }
 
-  auto pluginPaths = collectPlugins();
-  loadPlugins(pluginPaths);
+  // the plugins are selected before any of them is loaded
+  pluginSelection.parse(argc, argv);
+  auto builtinPlugins = collectBuiltinPlugins();
+  auto cli = createCli();
+
+  bool cachedHelpRequested = (earlyRequest == Cli::EarlyRequest::HELP)
+                             && !appInfo.helpCachePath.empty();
+  if (appInfo.pipelinedBoot && !cachedHelpRequested) {
+    auto pluginPaths = bootPipelined(builtinPlugins);
+    updateHelpFingerprint(pluginPaths);
+  }
+  else {
+    auto pluginPaths = collectPlugins();
+    updateHelpFingerprint(pluginPaths);
+    if (cachedHelpRequested && printCachedHelp()) {
+      return EXIT_SUCCESS;
+    }
+
+    PluginPrefetcher prefetcher;
+    if (appInfo.prefetchPlugins) {
+      prefetcher.prefetch(pluginPaths);
+    }
+
+    for (auto& plugin: builtinPlugins) {
+      pluginSystem.addPlugin(std::move(plugin));
+    }
+    loadPlugins(pluginPaths);
+    pluginSystem.prepare(cli, *this);
+  }
 
-  auto parseResult = parseCli(argc, argv);
+  auto parseResult = parseCli(cli, argc, argv);
   if (parseResult == CliParseResult::QUIT) {
+    if (appInfo.fastExit) {
+      exitFast(EXIT_SUCCESS);
+    }
     return EXIT_SUCCESS;
   }
 
-  pluginSystem.initialize();
-  pluginSystem.start();
+  {
+    std::lock_guard<std::recursive_mutex> lock(lifecycleMutex);
+    // quit() during the boot (e.g. on a signal) had no plugins to stop
+    if (!quitCalled) {
+      pluginSystem.initialize();
+      pluginSystem.start();
+      pluginsStarted = true;
+    }
+  }
+
+  int result = EXIT_SUCCESS;
+  if (!quitCalled) {
+    if (startupReportRequested) {
+      printStartupReport(std::cout, pluginSystem.getStartupReport());
+      printLoadReport(std::cout, loadReport);
+    }
+    result = execMainLoop();
+  }
+  // quit() may still be stopping the plugins on another thread
+  waitForQuit();
 
-  return execMainLoop();
+  if (appInfo.fastExit) {
+    exitFast(result);
+  }
+  return result;
 }
 
 int Application::exec()
@@ -94,8 +286,22 @@ void Application::addOnBeforeCliParseHook(const OnBeforeCliParseHook& hook)
 
 void Application::quit()
 {
-  quitCalled = true;
-  pluginSystem.stop();
+  if (quitCalled.exchange(true)) {
+    return;
+  }
+  if (reactor) {
+    reactor->stop();
+  }
+  {
+    std::lock_guard<std::recursive_mutex> lock(lifecycleMutex);
+    pluginSystem.stop();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(quitMutex);
+    quitFinished = true;
+  }
+  quitFinishedCondition.notify_all();
 }
 
 void Application::setMainLoop(const MainLoop& loop)
@@ -106,10 +312,92 @@ void Application::setMainLoop(const MainLoop& loop)
   mainLoop = loop;
 }
 
+void Application::addMainLoop(const std::string& name, const MainLoop& loop, int cpu)
+{
+  for (const auto& namedLoop: namedLoops) {
+    if (namedLoop.name == name) {
+      throw std::runtime_error("Possible plugin conflict - main loop '" + name + "' already added");
+    }
+  }
+  namedLoops.push_back({name, loop, cpu, {}, EXIT_SUCCESS, nullptr});
+}
+
+const Application::LoopExitCodes& Application::getLoopExitCodes() const
+{
+  return loopExitCodes;
+}
+
+const PluginSystem::StopReport& Application::getStopReport() const
+{
+  return pluginSystem.getStopReport();
+}
+
+PluginSystem::StartupReport Application::getStartupReport() const
+{
+  return pluginSystem.getStartupReport();
+}
+
+const Application::LoadReport& Application::getLoadReport() const
+{
+  return loadReport;
+}
+
+void Application::exitFast(int exitCode)
+{
+  restoreInterruptHandler();
+  quit();
+  waitForQuit();
+
+  for (auto& hook: onExitFlushHooks) {
+    hook();
+  }
+  std::cout.flush();
+  std::cerr.flush();
+  std::fflush(nullptr);
+
+  // no static destructors, no atexit handlers, no dlclose()
+  std::_Exit(exitCode);
+}
+
+const ResourceRegistry& Application::getResourceRegistry() const
+{
+  return pluginSystem.getResourceRegistry();
+}
+
+Application::HookId Application::addOnPluginStoppedHook(const OnPluginStoppedHook& hook)
+{
+  return pluginSystem.addOnPluginStoppedHook(hook);
+}
+
+void Application::removeOnPluginStoppedHook(HookId id)
+{
+  pluginSystem.removeOnPluginStoppedHook(id);
+}
+
+void Application::setStopDeadline(const std::string& pluginName,
+                                  std::chrono::milliseconds deadline)
+{
+  pluginSystem.setStopDeadline(pluginName, deadline);
+}
+
+void Application::addOnExitFlushHook(const OnExitFlushHook& hook)
+{
+  onExitFlushHooks.push_back(hook);
+}
+
+IReactor& Application::getReactor()
+{
+  if (!reactor) {
+    throw ReactorException("The reactor is not supported on this platform");
+  }
+  return *reactor;
+}
+
 PluginCollector::Paths Application::collectPlugins()
 {
   PluginCollector collector;
   collector.addDirectories(pluginDirs);
+  collector.addBundles(pluginBundles);
 
 #ifdef _WIN32
   collector.addPluginExtension("dll");
@@ -117,34 +405,131 @@ PluginCollector::Paths Application::collectPlugins()
   collector.addPluginExtension("so");
 #endif
 
+  if (pluginSelection.isRestricted()) {
+    collector.setFilter([this](const std::string& pluginName){
+      return pluginSelection.isSelected(pluginName);
+    });
+  }
+
+  return collector.collectPlugins();
+}
+
+PluginSystem::LoadedPlugins Application::collectBuiltinPlugins()
+{
+  PluginSystem::LoadedPlugins plugins;
   for (auto& preloadedPlugin: preloadedPlugins) {
-    pluginSystem.addPlugin(std::move(preloadedPlugin));
+    builtinPluginNames.push_back(preloadedPlugin->getName());
+    plugins.push_back(std::move(preloadedPlugin));
   }
   preloadedPlugins.clear();
 
-  return collector.collectPlugins();
+  for (const auto& staticPlugin: getStaticPlugins()) {
+    auto plugin = staticPlugin.makePlugin();
+    if (!pluginSelection.isSelected(plugin->getName())) {
+      continue;
+    }
+    builtinPluginNames.push_back(plugin->getName());
+    plugins.push_back(IPluginDPtr(plugin.release(), [](auto* obj){delete obj;}));
+  }
+  return plugins;
 }
 
 void Application::loadPlugins(const PluginCollector::Paths& pluginPaths)
 {
+  // one loader maps each plugin bundle once
   auto loader = cppps::getPluginLoader();
   for (const auto& pluginPath: pluginPaths) {
-    auto plugin = loader.load(pluginPath);
+    pluginSystem.addPlugin(loadMeasured(loader, pluginPath));
+  }
+}
+
+IPluginDPtr Application::loadMeasured(IPluginLoader& loader, const std::string& pluginPath)
+{
+  // the faults are counted per thread, so the prefetching and
+  // the plugins already running do not add to the count
+  auto majorFaults = getCurrentThreadMajorFaults();
+  auto loadStart = std::chrono::steady_clock::now();
+  auto plugin = loader.load(pluginPath);
+  auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - loadStart);
+  if (majorFaults >= 0) {
+    majorFaults = getCurrentThreadMajorFaults() - majorFaults;
+  }
+  loadReport.push_back({pluginPath, duration, majorFaults});
+  return plugin;
+}
+
+PluginCollector::Paths Application::bootPipelined(PluginSystem::LoadedPlugins& builtinPlugins)
+{
+  // the plugins are prepared on this thread in a deterministic order
+  // while the following ones are being scanned and loaded
+  PluginPrefetcher prefetcher;
+  auto loader = cppps::getPluginLoader();
+  PluginLoadingPipeline pipeline([this, &prefetcher](){
+                                   auto pluginPaths = collectPlugins();
+                                   if (appInfo.prefetchPlugins) {
+                                     prefetcher.prefetch(pluginPaths);
+                                   }
+                                   return pluginPaths;
+                                 },
+                                 [this, &loader](const std::string& pluginPath){
+                                   // the report is read only after the pipeline is done
+                                   return loadMeasured(loader, pluginPath);
+                                 });
+
+  for (auto& plugin: builtinPlugins) {
+    plugin->prepare(cli, *this);
     pluginSystem.addPlugin(std::move(plugin));
   }
+  while (auto plugin = pipeline.next()) {
+    plugin->prepare(cli, *this);
+    pluginSystem.addPlugin(std::move(plugin));
+  }
+  return pipeline.getPaths();
 }
 
-Application::CliParseResult Application::parseCli(int argc, char** argv)
+void Application::updateHelpFingerprint(const PluginCollector::Paths& pluginPaths)
 {
-  auto cli = std::make_shared<Cli>(appInfo);
+  if (!appInfo.helpCachePath.empty()) {
+    helpFingerprint = HelpCache::makeFingerprint(appInfo, pluginPaths, builtinPluginNames);
+  }
+}
 
-  pluginSystem.prepare(cli, *this);
+bool Application::printCachedHelp()
+{
+  auto help = HelpCache(appInfo.helpCachePath).read(helpFingerprint);
+  if (!help) {
+    return false;
+  }
+  std::cout << *help;
+  return true;
+}
+
+CliPtr Application::createCli()
+{
+  auto cli = std::make_shared<Cli>(appInfo);
+  // kept for the plugins added at runtime
+  this->cli = cli;
+  cli->addFlag("--startup-report", startupReportRequested,
+               "Print the critical path of the plugin initialization");
+  // handled by PluginSelection before the plugins are loaded
+  cli->addOption(PluginSelection::PLUGINS_OPTION, pluginsOption,
+                 "Comma-separated patterns of the plugins to load", false);
+  cli->addOption(PluginSelection::DISABLE_PLUGINS_OPTION, disabledPluginsOption,
+                 "Comma-separated patterns of the plugins not to load", false);
+  return cli;
+}
 
+Application::CliParseResult Application::parseCli(const CliPtr& cli, int argc, char** argv)
+{
   for(auto& hook: onBeforeCliParseHooks) {
     hook(cli);
   }
 
   cli->parse(argc, argv);
+  if (!helpFingerprint.empty()) {
+    HelpCache(appInfo.helpCachePath).update(helpFingerprint, cli->getHelp());
+  }
   if (cli->hasMessage()) {
     std::cout << cli->getMessage();
   }
@@ -158,16 +543,127 @@ Application::CliParseResult Application::parseCli(int argc, char** argv)
 
 int Application::execMainLoop()
 {
+  startNamedLoops();
+
   int result = EXIT_SUCCESS;
   if (mainLoop) {
+    std::thread reactorThread;
+    if (reactor && reactor->hasSources()) {
+      reactorThread = std::thread([this](){reactor->run();});
+    }
+
     result = mainLoop();
     // dispose main loop handle in case
     // a plugin passed lambda capturing "this":
     mainLoop = nullptr;
+
+    if (reactorThread.joinable()) {
+      reactor->stop();
+      reactorThread.join();
+    }
+  }
+  else if (reactor && (reactor->hasSources() || runningLoops > 0)) {
+    // also waits for quit() or the named loops to finish
+    result = reactor->run();
+  }
+  return joinNamedLoops(result);
+}
+
+void Application::startNamedLoops()
+{
+  // the reactor waits for the loops when there is no main loop
+  const bool stopReactor = (reactor && !mainLoop);
+  runningLoops = namedLoops.size();
+  for (auto& namedLoop: namedLoops) {
+    namedLoop.thread = std::thread([this, &namedLoop, stopReactor](){
+      setCurrentThreadName(namedLoop.name);
+      if (namedLoop.cpu != ANY_CPU && !setCurrentThreadAffinity(namedLoop.cpu)) {
+        std::cerr << "Cannot pin the '" << namedLoop.name << "' loop to CPU "
+                  << namedLoop.cpu << std::endl;
+      }
+
+      try {
+        namedLoop.exitCode = namedLoop.loop();
+      }
+      catch (...) {
+        namedLoop.exitCode = EXIT_FAILURE;
+        namedLoop.exception = std::current_exception();
+      }
+
+      if (--runningLoops == 0 && stopReactor) {
+        reactor->stop();
+      }
+    });
+  }
+}
+
+int Application::joinNamedLoops(int result)
+{
+  if (namedLoops.empty()) {
+    return result;
+  }
+
+  // stopped plugins make their loops return
+  if (!quitCalled) {
+    quit();
+  }
+
+  std::exception_ptr exception {nullptr};
+  for (auto& namedLoop: namedLoops) {
+    namedLoop.thread.join();
+    loopExitCodes.emplace_back(namedLoop.name, namedLoop.exitCode);
+    if (result == EXIT_SUCCESS) {
+      result = namedLoop.exitCode;
+    }
+    if (!exception) {
+      exception = namedLoop.exception;
+    }
+    // dispose the loop handles, as with the main loop
+    namedLoop.loop = nullptr;
+  }
+  namedLoops.clear();
+
+  if (exception) {
+    std::rethrow_exception(exception);
   }
   return result;
 }
 
+void Application::addStartedPlugin(IPluginDPtr&& plugin)
+{
+  std::lock_guard<std::recursive_mutex> lock(lifecycleMutex);
+  if (!pluginsStarted || quitCalled) {
+    throw std::runtime_error("Plugin '" + plugin->getName()
+                             + "' can be added only to a running application");
+  }
+
+  pluginSystem.addPlugin(std::move(plugin));
+  pluginSystem.prepare(cli, *this);
+  pluginSystem.initialize();
+  pluginSystem.start();
+}
+
+void Application::replaceStartedPlugin(IPluginDPtr&& plugin)
+{
+  std::lock_guard<std::recursive_mutex> lock(lifecycleMutex);
+  if (!pluginsStarted || quitCalled) {
+    throw std::runtime_error("Plugin '" + plugin->getName()
+                             + "' can be reloaded only in a running application");
+  }
+
+  pluginSystem.reload(std::move(plugin), cli, *this);
+}
+
+void Application::waitForQuit()
+{
+  if (!quitCalled) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(quitMutex);
+  quitFinishedCondition.wait(lock, [this](){return quitFinished;});
+}
+
+#ifdef _WIN32
 void Application::setupInterruptHandler()
 {
   quitApp = [this](int){
@@ -177,3 +673,60 @@ void Application::setupInterruptHandler()
   signal(SIGINT, signalHandler);
   signal(SIGTERM, signalHandler);
 }
+
+void Application::restoreInterruptHandler()
+{
+  quitApp = [](int){};
+}
+#else
+void Application::setupInterruptHandler()
+{
+  if (signalThread.joinable()) {
+    return;
+  }
+
+  if (pipe2(signalPipe, O_CLOEXEC) < 0) {
+    throw std::runtime_error("Cannot create the signal pipe");
+  }
+
+  signalThread = std::thread([this](){
+    setCurrentThreadName("signals");
+    unsigned char signal;
+    while (true) {
+      auto result = read(signalPipe[0], &signal, sizeof(signal));
+      if (result < 0 && errno == EINTR) {
+        continue;
+      }
+      if (result <= 0 || signal == STOP_SIGNAL_THREAD) {
+        break;
+      }
+      quit();
+    }
+  });
+
+  struct sigaction action {};
+  action.sa_handler = signalHandler;
+  sigemptyset(&action.sa_mask);
+  action.sa_flags = SA_RESTART;
+  sigaction(SIGINT, &action, nullptr);
+  sigaction(SIGTERM, &action, nullptr);
+}
+
+void Application::restoreInterruptHandler()
+{
+  if (!signalThread.joinable()) {
+    return;
+  }
+
+  signal(SIGINT, SIG_DFL);
+  signal(SIGTERM, SIG_DFL);
+
+  auto stop = STOP_SIGNAL_THREAD;
+  [[maybe_unused]] auto result = write(signalPipe[1], &stop, sizeof(stop));
+  signalThread.join();
+
+  close(signalPipe[0]);
+  close(signalPipe[1]);
+  signalPipe[0] = signalPipe[1] = -1;
+}
+#endif
@@ -4,12 +4,14 @@
 
 #include "cppps/dl/Cli.h"
 #include <CLI/CLI.hpp>
+#include <string_view>
 
 using cppps::Cli;
 
 namespace {
 
 constexpr int VERSION_REQUEST_CODE = -1;
+constexpr std::string_view END_OF_OPTIONS = "--";
 
 void setupStandardOptions(CLI::App& cliApp)
 {
@@ -38,6 +40,23 @@ Cli::Cli(const AppInfo& appInfo)
 
 Cli::~Cli() = default;
 
+Cli::EarlyRequest Cli::findEarlyRequest(int argc, char* argv[])
+{
+  for (int i = 1; i < argc; ++i) {
+    std::string_view arg = argv[i];
+    if (arg == END_OF_OPTIONS) {
+      break;
+    }
+    if (arg == "-h" || arg == "--help") {
+      return EarlyRequest::HELP;
+    }
+    if (arg == "-v" || arg == "--version") {
+      return EarlyRequest::VERSION;
+    }
+  }
+  return EarlyRequest::NONE;
+}
+
 void Cli::parse(int argc, char* argv[])
 {
   auto& cliApp = pimpl->cliApp;
@@ -69,6 +88,11 @@ const std::string& Cli::getMessage() const
   return message;
 }
 
+std::string Cli::getHelp() const
+{
+  return pimpl->cliApp.help();
+}
+
 void Cli::addOption(std::string_view option, std::string& target,
                          std::string_view description, bool defaulted)
 {
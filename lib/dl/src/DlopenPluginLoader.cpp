@@ -4,7 +4,12 @@
 
 #include "DlopenPluginLoader.h"
 #include "cppps/dl/exceptions.h"
+#include "cppps/dl/PluginBundle.h"
 #include <dlfcn.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <memory>
 
 using cppps::DlopenPluginLoader;
 using cppps::IPlugin;
@@ -13,15 +18,65 @@ using cppps::IPluginUPtr;
 
 namespace {
 
+class BundledImage
+{
+public:
+  BundledImage(const cppps::PluginBundle& bundle, const std::string& name)
+  {
+    auto entry = bundle.findEntry(name);
+    if (!entry) {
+      throw cppps::PluginNotFoundException("Cannot find plugin image " + name
+                                           + " in bundle: " + bundle.getPath());
+    }
+    fd = bundle.openImage(*entry);
+  }
+
+  ~BundledImage()
+  {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+
+  BundledImage(const BundledImage&) = delete;
+  BundledImage& operator=(const BundledImage&) = delete;
+
+  std::string getPath() const
+  {
+    return "/proc/self/fd/" + std::to_string(fd);
+  }
+
+  /**
+   * @brief Leave the memory file open for the rest of the process
+   */
+  void release()
+  {
+    fd = -1;
+  }
+
+private:
+  int fd {-1};
+};
+
 class Library
 {
 public:
   Library(const std::string& path)
   {
-    handle = dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL);
-    if (!handle) {
-      throw cppps::PluginNotFoundException("Cannot load library: " + std::string(dlerror()));
-    }
+    openLibrary(path);
+  }
+
+  /**
+   * @brief Load the bundled image, keeping its memory file open
+   *
+   * The dynamic linker recognizes loaded objects by the path, so the
+   * descriptor number must not be reused while the library is loaded,
+   * otherwise the next image gets the handle of this one.
+   */
+  Library(std::unique_ptr<BundledImage> image)
+    : image{std::move(image)}
+  {
+    openLibrary(this->image->getPath());
   }
 
   template <class T>
@@ -42,6 +97,17 @@ public:
       dlclose(handle);
       handle = nullptr;
     }
+    if (image) {
+      // a library that cannot be unloaded (e.g. with unique symbols)
+      // keeps its path, so the descriptor number stays taken
+      auto path = image->getPath();
+      auto residentHandle = dlopen(path.c_str(), RTLD_NOW | RTLD_NOLOAD);
+      if (residentHandle) {
+        dlclose(residentHandle);
+        image->release();
+      }
+      image.reset();
+    }
   }
 
   ~Library()
@@ -52,7 +118,17 @@ public:
 private:
   using LibraryHandle = void*;
 
+  std::unique_ptr<BundledImage> image;
   LibraryHandle handle {nullptr};
+
+private:
+  void openLibrary(const std::string& path)
+  {
+    handle = dlopen(path.c_str(), RTLD_NOW | RTLD_GLOBAL);
+    if (!handle) {
+      throw cppps::PluginNotFoundException("Cannot load library: " + std::string(dlerror()));
+    }
+  }
 };
 
 struct PluginDeleter
@@ -88,7 +164,24 @@ IPluginDPtr bindPlugin(IPluginUPtr&& plugin, PluginDeleter::LibTypePtr& lib)
 
 cppps::IPluginDPtr DlopenPluginLoader::load(std::string_view path)
 {
-  auto lib = std::make_shared<Library>(path.data());
+  std::shared_ptr<Library> lib;
+  auto bundleEntry = cppps::splitBundleEntryPath(path);
+  if (bundleEntry && !std::filesystem::exists(path)) {
+    lib = std::make_shared<Library>(
+      std::make_unique<BundledImage>(getBundle(bundleEntry->first), bundleEntry->second));
+  }
+  else {
+    lib = std::make_shared<Library>(std::string(path));
+  }
   auto makePlugin = lib->importSymbol<IPluginUPtr(*)()>("make_plugin");
   return bindPlugin(makePlugin(), lib);
 }
+
+const cppps::PluginBundle& DlopenPluginLoader::getBundle(const std::string& path)
+{
+  auto it = bundles.find(path);
+  if (it == bundles.end()) {
+    it = bundles.emplace(path, std::make_shared<PluginBundle>(path)).first;
+  }
+  return *it->second;
+}
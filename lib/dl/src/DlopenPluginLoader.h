@@ -7,12 +7,31 @@
 
 #include <cppps/dl/IPluginLoader.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
 namespace cppps {
 
+class PluginBundle;
+
+/**
+ * @brief Loads the plugin libraries with dlopen().
+ *
+ * A bundle is mapped and its index is read once per loader, so a loader
+ * kept for the whole boot serves all the bundled plugins from one mapping.
+ * A loader is meant to be used by one thread at a time.
+ */
 class DlopenPluginLoader: public IPluginLoader
 {
 public:
   cppps::IPluginDPtr load(std::string_view path) override;
+
+private:
+  std::map<std::string, std::shared_ptr<PluginBundle>> bundles;
+
+private:
+  const PluginBundle& getBundle(const std::string& path);
 };
 
 
@@ -0,0 +1,132 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/EpochDomain.h"
+
+#include <thread>
+
+using cppps::EpochDomain;
+
+namespace {
+
+// an object retired in epoch E is unreachable for
+// every reader once the epoch reaches E + 2
+constexpr uint64_t GRACE_EPOCHS = 2;
+
+size_t getThreadStripe(size_t stripes)
+{
+  thread_local const size_t hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  return hash % stripes;
+}
+
+} // namespace
+
+EpochDomain::Guard::Guard(std::atomic<int64_t>* counter)
+  : counter{counter}
+{
+  // empty
+}
+
+EpochDomain::Guard::Guard(Guard&& rhs) noexcept
+  : counter{rhs.counter}
+{
+  rhs.counter = nullptr;
+}
+
+EpochDomain::Guard::~Guard()
+{
+  if (counter) {
+    counter->fetch_sub(1, std::memory_order_release);
+  }
+}
+
+EpochDomain::~EpochDomain()
+{
+  for (auto& item: retired) {
+    item.deleter();
+  }
+}
+
+EpochDomain::Guard EpochDomain::enter()
+{
+  auto& stripe = stripes[getThreadStripe(STRIPES)];
+  auto parity = epoch.load(std::memory_order_seq_cst) & 1;
+  auto* counter = &stripe.readers[parity];
+  counter->fetch_add(1, std::memory_order_seq_cst);
+  return Guard(counter);
+}
+
+void EpochDomain::retire(Deleter deleter)
+{
+  std::lock_guard<std::mutex> lock(retireMutex);
+  retired.push_back({epoch.load(std::memory_order_seq_cst), std::move(deleter)});
+}
+
+void EpochDomain::reclaim()
+{
+  std::list<Retired> reclaimable;
+  {
+    std::lock_guard<std::mutex> lock(retireMutex);
+    reclaimable = takeReclaimable();
+  }
+
+  // call deleters outside the lock
+  for (auto& item: reclaimable) {
+    item.deleter();
+  }
+}
+
+void EpochDomain::synchronize()
+{
+  while (true) {
+    reclaim();
+    if (getRetiredCount() == 0) {
+      break;
+    }
+    std::this_thread::yield();
+  }
+}
+
+size_t EpochDomain::getRetiredCount() const
+{
+  std::lock_guard<std::mutex> lock(retireMutex);
+  return retired.size();
+}
+
+bool EpochDomain::tryAdvance()
+{
+  auto current = epoch.load(std::memory_order_seq_cst);
+  auto previousParity = (current + 1) & 1;
+
+  for (auto& stripe: stripes) {
+    if (stripe.readers[previousParity].load(std::memory_order_seq_cst) != 0) {
+      return false;
+    }
+  }
+
+  epoch.store(current + 1, std::memory_order_seq_cst);
+  return true;
+}
+
+std::list<EpochDomain::Retired> EpochDomain::takeReclaimable()
+{
+  std::list<Retired> reclaimable;
+  if (retired.empty()) {
+    return reclaimable;
+  }
+
+  for (uint64_t i = 0; i < GRACE_EPOCHS; ++i) {
+    if (retired.front().epoch + GRACE_EPOCHS <= epoch.load() || !tryAdvance()) {
+      break;
+    }
+  }
+
+  auto current = epoch.load(std::memory_order_seq_cst);
+  auto it = retired.begin();
+  while (it != retired.end() && it->epoch + GRACE_EPOCHS <= current) {
+    ++it;
+  }
+  reclaimable.splice(reclaimable.begin(), retired, retired.begin(), it);
+  return reclaimable;
+}
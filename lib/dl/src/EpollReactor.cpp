@@ -0,0 +1,344 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/EpollReactor.h"
+#include "cppps/dl/exceptions.h"
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+using cppps::EpollReactor;
+using cppps::ReactorException;
+
+namespace {
+
+constexpr int MAX_EVENTS = 64;
+
+std::string getErrorMessage(const std::string& operation)
+{
+  return operation + " failed: " + std::strerror(errno);
+}
+
+uint32_t toEpollEvents(cppps::IReactor::Events events)
+{
+  uint32_t epollEvents = 0;
+  if (events & cppps::IReactor::READABLE) {
+    epollEvents |= EPOLLIN;
+  }
+  if (events & cppps::IReactor::WRITABLE) {
+    epollEvents |= EPOLLOUT;
+  }
+  return epollEvents;
+}
+
+cppps::IReactor::Events fromEpollEvents(uint32_t epollEvents)
+{
+  cppps::IReactor::Events events = 0;
+  if (epollEvents & (EPOLLIN | EPOLLPRI)) {
+    events |= cppps::IReactor::READABLE;
+  }
+  if (epollEvents & EPOLLOUT) {
+    events |= cppps::IReactor::WRITABLE;
+  }
+  if (epollEvents & EPOLLERR) {
+    events |= cppps::IReactor::FAILURE;
+  }
+  if (epollEvents & (EPOLLHUP | EPOLLRDHUP)) {
+    events |= cppps::IReactor::HANGUP;
+  }
+  return events;
+}
+
+} // namespace
+
+EpollReactor::EpollReactor()
+{
+  epollFd = epoll_create1(EPOLL_CLOEXEC);
+  if (epollFd < 0) {
+    throw ReactorException(getErrorMessage("epoll_create1"));
+  }
+
+  wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (wakeFd < 0) {
+    close(epollFd);
+    throw ReactorException(getErrorMessage("eventfd"));
+  }
+
+  epoll_event event {};
+  event.events = EPOLLIN;
+  event.data.fd = wakeFd;
+  if (epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event) < 0) {
+    close(wakeFd);
+    close(epollFd);
+    throw ReactorException(getErrorMessage("epoll_ctl"));
+  }
+}
+
+EpollReactor::~EpollReactor()
+{
+  close(wakeFd);
+  close(epollFd);
+}
+
+int EpollReactor::run()
+{
+  reactorThread = std::this_thread::get_id();
+  std::array<epoll_event, MAX_EVENTS> events;
+
+  while (!stopRequested) {
+    auto count = epoll_wait(epollFd, events.data(), MAX_EVENTS, getTimeout());
+    if (count < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      reactorThread = std::thread::id();
+      throw ReactorException(getErrorMessage("epoll_wait"));
+    }
+
+    for (int i = 0; i < count && !stopRequested; ++i) {
+      if (events[i].data.fd == wakeFd) {
+        uint64_t value;
+        while (read(wakeFd, &value, sizeof(value)) > 0) {}
+        runTasks();
+      }
+      else {
+        dispatch(events[i].data.fd, events[i].events);
+      }
+    }
+
+    if (!stopRequested) {
+      runTimers();
+    }
+  }
+
+  // the request is consumed so that the reactor can run again, while
+  // a stop() called before run() still makes it return at once
+  stopRequested = false;
+  reactorThread = std::thread::id();
+  return exitCode;
+}
+
+void EpollReactor::stop(int exitCode)
+{
+  this->exitCode = exitCode;
+  stopRequested = true;
+  wakeUp();
+}
+
+bool EpollReactor::hasSources() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return !fdCallbacks.empty() || !timers.empty() || !tasks.empty();
+}
+
+void EpollReactor::clear()
+{
+  std::map<int, std::shared_ptr<FdCallback>> droppedCallbacks;
+  std::map<TimerId, Timer> droppedTimers;
+  std::list<Callback> droppedTasks;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  for (const auto& [fd, callback]: fdCallbacks) {
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+  }
+  droppedCallbacks.swap(fdCallbacks);
+  droppedTimers.swap(timers);
+  droppedTasks.swap(tasks);
+  deadlines = {};
+}
+
+void EpollReactor::addFd(int fd, Events events, FdCallback callback)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  epoll_event event {};
+  event.events = toEpollEvents(events);
+  event.data.fd = fd;
+  if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0) {
+    throw ReactorException(getErrorMessage("Adding descriptor " + std::to_string(fd)));
+  }
+  fdCallbacks[fd] = std::make_shared<FdCallback>(std::move(callback));
+}
+
+void EpollReactor::modifyFd(int fd, Events events)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  epoll_event event {};
+  event.events = toEpollEvents(events);
+  event.data.fd = fd;
+  if (epoll_ctl(epollFd, EPOLL_CTL_MOD, fd, &event) < 0) {
+    throw ReactorException(getErrorMessage("Modifying descriptor " + std::to_string(fd)));
+  }
+}
+
+bool EpollReactor::removeFd(int fd)
+{
+  std::shared_ptr<FdCallback> callback;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = fdCallbacks.find(fd);
+  if (it == fdCallbacks.end()) {
+    return false;
+  }
+
+  // the descriptor may have been closed already
+  epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+  callback = std::move(it->second);
+  fdCallbacks.erase(it);
+  return true;
+}
+
+EpollReactor::TimerId EpollReactor::addTimer(Duration delay, Callback callback, Duration period)
+{
+  TimerId id;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    id = nextTimerId++;
+    auto deadline = Clock::now() + delay;
+    timers.emplace(id, Timer{deadline, period, std::make_shared<Callback>(std::move(callback))});
+    deadlines.push({deadline, id});
+  }
+
+  if (!isReactorThread()) {
+    // recalculate the epoll_wait() timeout
+    wakeUp();
+  }
+  return id;
+}
+
+bool EpollReactor::cancelTimer(TimerId id)
+{
+  std::shared_ptr<Callback> callback;
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = timers.find(id);
+  if (it == timers.end()) {
+    return false;
+  }
+
+  // the deadline entry is skipped when it reaches the top of the heap
+  callback = std::move(it->second.callback);
+  timers.erase(it);
+  return true;
+}
+
+void EpollReactor::post(Callback task)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    tasks.push_back(std::move(task));
+  }
+  wakeUp();
+}
+
+bool EpollReactor::isReactorThread() const
+{
+  return reactorThread.load() == std::this_thread::get_id();
+}
+
+void EpollReactor::wakeUp()
+{
+  uint64_t value = 1;
+  // async-signal-safe; the counter cannot overflow in practice
+  [[maybe_unused]] auto result = write(wakeFd, &value, sizeof(value));
+}
+
+int EpollReactor::getTimeout()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!tasks.empty()) {
+    return 0;
+  }
+
+  while (!deadlines.empty() && timers.count(deadlines.top().id) == 0) {
+    deadlines.pop();
+  }
+  if (deadlines.empty()) {
+    return -1;
+  }
+
+  auto remaining = deadlines.top().deadline - Clock::now();
+  if (remaining <= Duration(0)) {
+    return 0;
+  }
+
+  // round up, so the timers never expire early
+  auto ms = std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+  return static_cast<int>(std::min<decltype(ms)>(ms, INT32_MAX));
+}
+
+void EpollReactor::runTasks()
+{
+  std::list<Callback> pendingTasks;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    pendingTasks.swap(tasks);
+  }
+
+  for (auto it = pendingTasks.begin(); it != pendingTasks.end(); ++it) {
+    if (stopRequested) {
+      // the remaining tasks run first when the reactor runs again
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.splice(tasks.begin(), pendingTasks, it, pendingTasks.end());
+      }
+      wakeUp();
+      return;
+    }
+    (*it)();
+  }
+}
+
+void EpollReactor::runTimers()
+{
+  auto now = Clock::now();
+  while (!stopRequested) {
+    std::shared_ptr<Callback> callback;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (deadlines.empty() || deadlines.top().deadline > now) {
+        return;
+      }
+
+      auto id = deadlines.top().id;
+      deadlines.pop();
+      auto it = timers.find(id);
+      if (it == timers.end()) {
+        continue;
+      }
+
+      auto& timer = it->second;
+      callback = timer.callback;
+      if (timer.period > Duration(0)) {
+        timer.deadline += timer.period;
+        if (timer.deadline <= now) {
+          // skip the missed periods
+          timer.deadline = now + timer.period;
+        }
+        deadlines.push({timer.deadline, id});
+      }
+      else {
+        timers.erase(it);
+      }
+    }
+    (*callback)();
+  }
+}
+
+void EpollReactor::dispatch(int fd, uint32_t epollEvents)
+{
+  std::shared_ptr<FdCallback> callback;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = fdCallbacks.find(fd);
+    if (it == fdCallbacks.end()) {
+      return;
+    }
+    callback = it->second;
+  }
+  (*callback)(fromEpollEvents(epollEvents));
+}
@@ -0,0 +1,123 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "HelpCache.h"
+#include "OsUtils.h"
+#include "cppps/dl/PluginBundle.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+
+using cppps::HelpCache;
+
+namespace {
+
+constexpr auto CACHE_HEADER = "cppps-help-cache 1 ";
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+void hashText(uint64_t& hash, const std::string& text)
+{
+  // FNV-1a, stable between the runs unlike std::hash;
+  // the terminating zero separates the fields
+  for (auto character: text) {
+    hash = (hash ^ static_cast<unsigned char>(character)) * FNV_PRIME;
+  }
+  hash *= FNV_PRIME;
+}
+
+std::string getFileStamp(std::string path)
+{
+  // a bundled plugin changes with its bundle
+  auto bundleEntry = cppps::splitBundleEntryPath(path);
+  if (bundleEntry && !std::filesystem::exists(path)) {
+    path = bundleEntry->first;
+  }
+
+  std::error_code error;
+  auto size = std::filesystem::file_size(path, error);
+  if (error) {
+    return "?";
+  }
+  auto writeTime = std::filesystem::last_write_time(path, error);
+  if (error) {
+    return "?";
+  }
+  return std::to_string(size) + ':'
+      + std::to_string(writeTime.time_since_epoch().count());
+}
+
+} // namespace
+
+HelpCache::HelpCache(std::string path)
+  : path{std::move(path)}
+{
+  // empty
+}
+
+std::string HelpCache::makeFingerprint(const AppInfo& appInfo, const Paths& pluginPaths,
+                                       const Names& builtinPluginNames)
+{
+  auto hash = FNV_OFFSET_BASIS;
+  // a rebuilt program may add options or change the texts
+  hashText(hash, getFileStamp(getProgramPath()));
+  hashText(hash, appInfo.appName);
+  hashText(hash, appInfo.appDescription);
+  hashText(hash, std::to_string(appInfo.columnWidth));
+  for (const auto& pluginPath: pluginPaths) {
+    hashText(hash, pluginPath);
+    hashText(hash, getFileStamp(pluginPath));
+  }
+  for (const auto& name: builtinPluginNames) {
+    hashText(hash, name);
+  }
+
+  std::ostringstream stream;
+  stream << std::hex << hash;
+  return stream.str();
+}
+
+std::optional<std::string> HelpCache::read(const std::string& fingerprint) const
+{
+  std::ifstream file(path, std::ios::binary);
+  std::string header;
+  if (!file || !std::getline(file, header) || header != CACHE_HEADER + fingerprint) {
+    return std::nullopt;
+  }
+
+  std::string help((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  if (file.bad()) {
+    return std::nullopt;
+  }
+  return help;
+}
+
+void HelpCache::update(const std::string& fingerprint, const std::string& help) const
+{
+  if (read(fingerprint) == help) {
+    return;
+  }
+
+  std::error_code error;
+  auto parentPath = std::filesystem::path(path).parent_path();
+  if (!parentPath.empty()) {
+    std::filesystem::create_directories(parentPath, error);
+  }
+
+  // concurrent readers see either the old or the new file
+  auto tmpPath = path + ".tmp" + std::to_string(std::random_device()());
+  {
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    file << CACHE_HEADER << fingerprint << '\n' << help;
+    if (!file.flush()) {
+      std::filesystem::remove(tmpPath, error);
+      return;
+    }
+  }
+  std::filesystem::rename(tmpPath, path, error);
+}
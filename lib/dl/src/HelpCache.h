@@ -0,0 +1,53 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef HELPCACHE_H
+#define HELPCACHE_H
+
+#include "cppps/dl/AppInfo.h"
+
+#include <list>
+#include <optional>
+#include <string>
+
+namespace cppps {
+
+/**
+ * @brief Help page saved by the last run loading the plugins.
+ *
+ * The page is stored with the fingerprint of the program and the plugin
+ * set it has been built for (the executable, plugin file paths, sizes and
+ * modification times, the names of the built-in plugins and the AppInfo
+ * fields shown in the help), so it is served only as long as the same
+ * program would print it. Cache errors are never reported, the
+ * help is then built by loading the plugins.
+ */
+class HelpCache
+{
+public:
+  using Paths = std::list<std::string>;
+  using Names = std::list<std::string>;
+
+  explicit HelpCache(std::string path);
+
+  static std::string makeFingerprint(const AppInfo& appInfo, const Paths& pluginPaths,
+                                     const Names& builtinPluginNames);
+
+  /**
+   * @return Cached help page or nothing if the cache is missing or stale
+   */
+  std::optional<std::string> read(const std::string& fingerprint) const;
+
+  /**
+   * @brief Store the help page unless the cache is up to date
+   */
+  void update(const std::string& fingerprint, const std::string& help) const;
+
+private:
+  std::string path;
+};
+
+} // namespace cppps
+
+#endif // HELPCACHE_H
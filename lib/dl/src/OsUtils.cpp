@@ -9,11 +9,14 @@
 #ifdef __linux
 #include <unistd.h>
 #include <linux/limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
 #else
 #include <windows.h>
 #endif
 
-std::string cppps::getProgramDirPath()
+std::string cppps::getProgramPath()
 {
 
 #ifdef __unix
@@ -26,5 +29,48 @@ std::string cppps::getProgramDirPath()
   std::filesystem::path execPath = path;
 #endif
 
-  return execPath.parent_path().string();
+  return execPath.string();
+}
+
+std::string cppps::getProgramDirPath()
+{
+  return std::filesystem::path(getProgramPath()).parent_path().string();
+}
+
+bool cppps::setCurrentThreadAffinity(int cpu)
+{
+#ifdef __linux
+  if (cpu < 0 || cpu >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  CPU_SET(cpu, &cpuSet);
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+  return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+#endif
+}
+
+void cppps::setCurrentThreadName(const std::string& name)
+{
+#ifdef __linux
+  constexpr size_t MAX_NAME_LENGTH = 15;
+  pthread_setname_np(pthread_self(), name.substr(0, MAX_NAME_LENGTH).c_str());
+#else
+  (void)name;
+#endif
+}
+
+long cppps::getCurrentThreadMajorFaults()
+{
+#ifdef __linux
+  rusage usage;
+  if (getrusage(RUSAGE_THREAD, &usage) != 0) {
+    return -1;
+  }
+  return usage.ru_majflt;
+#else
+  return -1;
+#endif
 }
@@ -9,8 +9,30 @@
 
 namespace cppps {
 
+/**
+ * @brief Get the path of the running executable
+ */
+std::string getProgramPath();
+
 std::string getProgramDirPath();
 
+/**
+ * @brief Pin the calling thread to given CPU
+ * @return false if the affinity could not be set
+ */
+bool setCurrentThreadAffinity(int cpu);
+
+/**
+ * @brief Set the name of the calling thread (visible in debuggers and top)
+ */
+void setCurrentThreadName(const std::string& name);
+
+/**
+ * @brief Get the number of major page faults (served from the disk) of the calling thread
+ * @return -1 if not available
+ */
+long getCurrentThreadMajorFaults();
+
 }
 
 #endif // OSUTILS_H
@@ -0,0 +1,272 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/PluginBundle.h"
+#include "cppps/dl/exceptions.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using cppps::PluginBundle;
+using cppps::PluginBundleException;
+using cppps::PluginDescriptor;
+
+namespace {
+
+constexpr uint64_t IMAGE_ALIGNMENT = 4096;
+
+struct BundleHeader
+{
+  char magic[8] {};
+  uint32_t formatVersion {cppps::PLUGIN_BUNDLE_FORMAT_VERSION};
+  uint32_t entryCount {0};
+};
+
+struct BundleIndexEntry
+{
+  char name[128] {};
+  uint64_t offset {0};
+  uint64_t size {0};
+  uint32_t hasDescriptor {0};
+  uint32_t reserved {0};
+  PluginDescriptor descriptor {};
+};
+
+std::string getErrorMessage(const std::string& operation)
+{
+  return operation + " failed: " + std::strerror(errno);
+}
+
+uint64_t alignImageOffset(uint64_t offset)
+{
+  return (offset + IMAGE_ALIGNMENT - 1) / IMAGE_ALIGNMENT * IMAGE_ALIGNMENT;
+}
+
+std::string joinKeys(const std::vector<std::string>& keys)
+{
+  std::string result;
+  for (const auto& key: keys) {
+    result += (result.empty() ? "" : ",") + key;
+  }
+  return result;
+}
+
+std::string readFile(const std::string& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  if (!file.is_open() || file.bad()) {
+    throw PluginBundleException("Cannot read plugin file: " + path);
+  }
+  return content;
+}
+
+BundleIndexEntry makeIndexEntry(const std::string& pluginPath, uint64_t offset, uint64_t size)
+{
+  BundleIndexEntry entry;
+  auto name = std::filesystem::path(pluginPath).filename().string();
+  if (name.empty() || name.size() >= sizeof(entry.name)) {
+    throw PluginBundleException("Invalid plugin image name: " + pluginPath);
+  }
+  std::copy(name.begin(), name.end(), entry.name);
+  entry.offset = offset;
+  entry.size = size;
+
+  cppps::PluginInfos infos;
+  try {
+    infos = cppps::readPluginDescriptors(pluginPath);
+  }
+  catch (const cppps::PluginDescriptorException&) {
+    // not an ELF file, bundled without the descriptor
+  }
+  if (!infos.empty()) {
+    const auto& info = infos.front();
+    entry.descriptor = cppps::makePluginDescriptor(info.name, info.version,
+                                                   joinKeys(info.providedKeys),
+                                                   joinKeys(info.consumedKeys));
+    entry.descriptor.abiVersion = info.abiVersion;
+    entry.hasDescriptor = 1;
+  }
+  return entry;
+}
+
+void writeAll(int fd, const char* data, uint64_t size)
+{
+  while (size > 0) {
+    auto written = ::write(fd, data, size);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw PluginBundleException(getErrorMessage("Writing the plugin image"));
+    }
+    data += written;
+    size -= static_cast<uint64_t>(written);
+  }
+}
+
+} // namespace
+
+PluginBundle::PluginBundle(const std::string& path)
+  : path{path}
+{
+  auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw PluginBundleException(getErrorMessage("Opening the plugin bundle " + path));
+  }
+  struct stat status;
+  if (fstat(fd, &status) != 0) {
+    close(fd);
+    throw PluginBundleException(getErrorMessage("Examining the plugin bundle " + path));
+  }
+  size = static_cast<uint64_t>(status.st_size);
+  if (size < sizeof(BundleHeader)) {
+    close(fd);
+    throw PluginBundleException("Not a plugin bundle: " + path);
+  }
+  // the mapping outlives the descriptor
+  auto mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    throw PluginBundleException(getErrorMessage("Mapping the plugin bundle " + path));
+  }
+  data = static_cast<const char*>(mapping);
+
+  try {
+    BundleHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, PLUGIN_BUNDLE_MAGIC, sizeof(PLUGIN_BUNDLE_MAGIC)) != 0) {
+      throw PluginBundleException("Not a plugin bundle: " + path);
+    }
+    if (header.formatVersion != PLUGIN_BUNDLE_FORMAT_VERSION) {
+      throw PluginBundleException("Unsupported plugin bundle version: " + path);
+    }
+    if (header.entryCount > (size - sizeof(header)) / sizeof(BundleIndexEntry)) {
+      throw PluginBundleException("Truncated plugin bundle: " + path);
+    }
+
+    for (uint32_t i = 0; i < header.entryCount; ++i) {
+      BundleIndexEntry indexEntry;
+      std::memcpy(&indexEntry, data + sizeof(header) + i * sizeof(indexEntry), sizeof(indexEntry));
+      if (indexEntry.offset > size || indexEntry.size > size - indexEntry.offset) {
+        throw PluginBundleException("Truncated plugin bundle: " + path);
+      }
+
+      Entry entry {std::string(indexEntry.name, strnlen(indexEntry.name, sizeof(indexEntry.name))),
+                   indexEntry.offset, indexEntry.size, std::nullopt};
+      if (indexEntry.hasDescriptor) {
+        const auto& descriptor = indexEntry.descriptor;
+        if (std::memcmp(descriptor.magic, PLUGIN_DESCRIPTOR_MAGIC,
+                        sizeof(PLUGIN_DESCRIPTOR_MAGIC)) != 0
+            || descriptor.size != sizeof(PluginDescriptor)) {
+          throw PluginBundleException("Unsupported plugin descriptor in bundle: " + path);
+        }
+        entry.info = toPluginInfo(descriptor);
+      }
+      entries.push_back(std::move(entry));
+    }
+  }
+  catch (...) {
+    munmap(const_cast<char*>(data), size);
+    throw;
+  }
+}
+
+PluginBundle::~PluginBundle()
+{
+  munmap(const_cast<char*>(data), size);
+}
+
+const std::string& PluginBundle::getPath() const
+{
+  return path;
+}
+
+const PluginBundle::Entries& PluginBundle::getEntries() const
+{
+  return entries;
+}
+
+const PluginBundle::Entry* PluginBundle::findEntry(std::string_view name) const
+{
+  auto it = std::find_if(entries.begin(), entries.end(), [name](const auto& entry){
+    return entry.name == name;
+  });
+  return (it != entries.end()) ? &*it : nullptr;
+}
+
+std::string_view PluginBundle::getImage(const Entry& entry) const
+{
+  return std::string_view(data + entry.offset, entry.size);
+}
+
+int PluginBundle::openImage(const Entry& entry) const
+{
+#ifdef __linux
+  auto fd = memfd_create(entry.name.c_str(), MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (fd < 0) {
+    throw PluginBundleException(getErrorMessage("Creating the memory file for " + entry.name));
+  }
+  try {
+    auto image = getImage(entry);
+    writeAll(fd, image.data(), image.size());
+  }
+  catch (...) {
+    close(fd);
+    throw;
+  }
+  // the image cannot be changed through the descriptor once loaded
+  fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL);
+  return fd;
+#else
+  (void)entry;
+  throw PluginBundleException("Plugin bundles are not supported on this platform");
+#endif
+}
+
+void PluginBundle::write(const std::string& path, const Paths& pluginPaths)
+{
+  std::vector<BundleIndexEntry> index;
+  std::vector<std::string> images;
+  std::set<std::string> names;
+  auto offset = alignImageOffset(sizeof(BundleHeader)
+                                 + pluginPaths.size() * sizeof(BundleIndexEntry));
+  for (const auto& pluginPath: pluginPaths) {
+    images.push_back(readFile(pluginPath));
+    index.push_back(makeIndexEntry(pluginPath, offset, images.back().size()));
+    if (!names.insert(index.back().name).second) {
+      throw PluginBundleException("Duplicated plugin image name: " + pluginPath);
+    }
+    offset = alignImageOffset(offset + images.back().size());
+  }
+
+  BundleHeader header;
+  std::copy(std::begin(PLUGIN_BUNDLE_MAGIC), std::end(PLUGIN_BUNDLE_MAGIC), header.magic);
+  header.entryCount = static_cast<uint32_t>(index.size());
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    throw PluginBundleException("Cannot create plugin bundle: " + path);
+  }
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(index.data()),
+             static_cast<std::streamsize>(index.size() * sizeof(BundleIndexEntry)));
+  for (size_t i = 0; i < images.size(); ++i) {
+    auto padding = index[i].offset - static_cast<uint64_t>(file.tellp());
+    file << std::string(padding, '\0') << images[i];
+  }
+  if (!file.flush()) {
+    throw PluginBundleException("Cannot write plugin bundle: " + path);
+  }
+}
@@ -3,6 +3,11 @@
 // See accompanying file LICENSE.txt for the full license.
 
 #include "cppps/dl/PluginCollector.h"
+#ifndef _WIN32
+#include "cppps/dl/PluginBundle.h"
+#include "cppps/dl/PluginDescriptor.h"
+#include "cppps/dl/exceptions.h"
+#endif
 
 #include <map>
 #include <vector>
@@ -22,6 +27,7 @@ namespace {
 constexpr auto FULL_VERSION_MATCH_SIZE = 3;
 constexpr auto NAME_MATCH_INDEX = 1;
 constexpr auto VERSION_MATCH_INDEX = 2;
+constexpr std::string_view LIBRARY_PREFIX = "lib";
 
 struct PathEntry
 {
@@ -32,14 +38,29 @@ struct PathEntry
 };
 
 using PathMap = std::map<std::string /*name*/, PathEntry>;
+using NameMap = std::map<std::string /*path*/, std::string /*plugin name*/>;
 
 void appendDirectoriesScanResults(PluginCollector::Directories& dirs,
                                   const PluginCollector::Extensions& extensions,
                                   PathMap& paths);
 
+void appendBundlesScanResults(const PluginCollector::Bundles& bundles,
+                              const PluginCollector::Extensions& extensions,
+                              PathMap& paths,
+                              NameMap& descriptorNames);
+
+void addPathEntry(const PathEntry& pathEntry, PathMap& paths);
+
 PathEntry matchPath(const std::filesystem::path& path,
                     const PluginCollector::Extensions& extensions);
 
+std::string getPluginName(const std::string& path,
+                          const PluginCollector::Extensions& extensions,
+                          const NameMap& descriptorNames);
+
+std::string getFilePluginName(const std::filesystem::path& path,
+                              const PluginCollector::Extensions& extensions);
+
 std::vector<std::string> split(std::string_view text);
 
 }
@@ -59,6 +80,16 @@ void PluginCollector::addDirectories(const Directories& dirs)
   this->dirs.insert(this->dirs.end(), dirs.begin(), dirs.end());
 }
 
+void PluginCollector::addBundle(std::string_view bundlePath)
+{
+  bundles.emplace_back(bundlePath);
+}
+
+void PluginCollector::addBundles(const Bundles& bundles)
+{
+  this->bundles.insert(this->bundles.end(), bundles.begin(), bundles.end());
+}
+
 void PluginCollector::enablePathEnvVariable(std::string_view name)
 {
   pathEnvVariableName = name;
@@ -69,10 +100,16 @@ void PluginCollector::enableFileEnvVariable(std::string_view name)
   fileEnvVariableName = name;
 }
 
+void PluginCollector::setFilter(const Filter& filter)
+{
+  this->filter = filter;
+}
+
 PluginCollector::Paths PluginCollector::collectPlugins()
 {
   Paths paths;
   PathMap pathMap;
+  NameMap descriptorNames;
 
   if (!fileEnvVariableName.empty()) {
     appendEnvVariableFiles(paths);
@@ -83,10 +120,17 @@ PluginCollector::Paths PluginCollector::collectPlugins()
   }
 
   appendDirectoriesScanResults(dirs, extensions, pathMap);
+  appendBundlesScanResults(bundles, extensions, pathMap, descriptorNames);
 
   transform(pathMap.begin(), pathMap.end(), std::back_inserter(paths),
             [](const PathMap::value_type& val){return val.second.path.string();} );
 
+  if (filter) {
+    paths.remove_if([this, &descriptorNames](const std::string& path){
+      return !filter(getPluginName(path, extensions, descriptorNames));
+    });
+  }
+
   return paths;
 }
 
@@ -127,19 +171,55 @@ void appendDirectoriesScanResults(PluginCollector::Directories& dirs,
     for (const auto& path: dirIt) {
       auto pathEntry = matchPath(path, extensions);
       if (pathEntry.valid) {
-        auto it = paths.find(pathEntry.name);
-        if (it != paths.end()) {
-          if (it->second.version > pathEntry.version) {
-            continue;
-          }
-          it->second = pathEntry;
-        }
-        else {
-          paths.insert(std::make_pair(pathEntry.name, pathEntry));
+        addPathEntry(pathEntry, paths);
+      }
+    }
+  }
+}
+
+void appendBundlesScanResults(const PluginCollector::Bundles& bundles,
+                              const PluginCollector::Extensions& extensions,
+                              PathMap& paths,
+                              NameMap& descriptorNames)
+{
+#ifndef _WIN32
+  for (const auto& bundlePath: bundles) {
+    if (!std::filesystem::exists(bundlePath)) {
+      continue;
+    }
+    // one index read instead of a directory scan
+    cppps::PluginBundle bundle(bundlePath);
+    for (const auto& entry: bundle.getEntries()) {
+      auto pathEntry = matchPath(entry.name, extensions);
+      if (pathEntry.valid) {
+        pathEntry.path = cppps::makeBundleEntryPath(bundlePath, entry.name);
+        if (entry.info) {
+          descriptorNames[pathEntry.path.string()] = entry.info->name;
         }
+        addPathEntry(pathEntry, paths);
       }
     }
   }
+#else
+  (void)bundles;
+  (void)extensions;
+  (void)paths;
+  (void)descriptorNames;
+#endif
+}
+
+void addPathEntry(const PathEntry& pathEntry, PathMap& paths)
+{
+  auto it = paths.find(pathEntry.name);
+  if (it != paths.end()) {
+    if (it->second.version > pathEntry.version) {
+      return;
+    }
+    it->second = pathEntry;
+  }
+  else {
+    paths.insert(std::make_pair(pathEntry.name, pathEntry));
+  }
 }
 
 PathEntry matchPath(const std::filesystem::path& path,
@@ -164,6 +244,43 @@ PathEntry matchPath(const std::filesystem::path& path,
   return entry;
 }
 
+std::string getPluginName(const std::string& path,
+                          const PluginCollector::Extensions& extensions,
+                          const NameMap& descriptorNames)
+{
+  // the descriptor name is the name the plugin reports, as for the static plugins
+  auto it = descriptorNames.find(path);
+  if (it != descriptorNames.end()) {
+    return it->second;
+  }
+#ifndef _WIN32
+  try {
+    auto infos = cppps::readPluginDescriptors(path);
+    if (!infos.empty()) {
+      return infos.front().name;
+    }
+  }
+  catch (const cppps::PluginDescriptorException&) {
+    // not an ELF file or a bundled image, named after the file
+  }
+#endif
+  return getFilePluginName(path, extensions);
+}
+
+std::string getFilePluginName(const std::filesystem::path& path,
+                              const PluginCollector::Extensions& extensions)
+{
+  auto entry = matchPath(path, extensions);
+  // the matched name ends with the extension
+  std::string name = entry.valid ? entry.name.substr(0, entry.name.rfind('.'))
+                                 : path.stem().string();
+  if (name.compare(0, LIBRARY_PREFIX.size(), LIBRARY_PREFIX) == 0
+      && name.size() > LIBRARY_PREFIX.size()) {
+    name.erase(0, LIBRARY_PREFIX.size());
+  }
+  return name;
+}
+
 std::vector<std::string> split(std::string_view text)
 {
   std::vector<std::string> vector;
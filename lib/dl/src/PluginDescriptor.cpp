@@ -0,0 +1,179 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/PluginDescriptor.h"
+#include "cppps/dl/exceptions.h"
+
+#include <cstring>
+#include <fstream>
+
+#include <elf.h>
+
+using cppps::PluginDescriptor;
+using cppps::PluginDescriptorException;
+using cppps::PluginInfo;
+using cppps::PluginInfos;
+
+namespace {
+
+constexpr auto DESCRIPTOR_SECTION_NAME = "cppps_plugin_info";
+
+struct Elf32
+{
+  using Ehdr = Elf32_Ehdr;
+  using Shdr = Elf32_Shdr;
+};
+
+struct Elf64
+{
+  using Ehdr = Elf64_Ehdr;
+  using Shdr = Elf64_Shdr;
+};
+
+class ElfFile
+{
+public:
+  explicit ElfFile(const std::string& path)
+    : path{path}
+    , file{path, std::ios::binary}
+  {
+    if (!file) {
+      throw PluginDescriptorException("Cannot open plugin file: " + path);
+    }
+    file.seekg(0, std::ios::end);
+    fileSize = static_cast<uint64_t>(file.tellg());
+  }
+
+  template <class T>
+  void read(uint64_t offset, T* data, uint64_t count = 1)
+  {
+    auto size = sizeof(T) * count;
+    checkRange(offset, size);
+    file.seekg(static_cast<std::streamoff>(offset));
+    file.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(size));
+    if (!file) {
+      throw PluginDescriptorException("Cannot read plugin file: " + path);
+    }
+  }
+
+  void checkRange(uint64_t offset, uint64_t size) const
+  {
+    if (offset > fileSize || size > fileSize - offset) {
+      throw PluginDescriptorException("Truncated ELF file: " + path);
+    }
+  }
+
+  const std::string& getPath() const {return path;}
+
+private:
+  std::string path;
+  std::ifstream file;
+  uint64_t fileSize {0};
+};
+
+std::string getField(const char* field, size_t size)
+{
+  return std::string(field, strnlen(field, size));
+}
+
+std::vector<std::string> splitKeys(const std::string& keys)
+{
+  std::vector<std::string> result;
+  size_t begin = 0;
+  while (begin < keys.size()) {
+    auto end = keys.find(',', begin);
+    if (end == std::string::npos) {
+      end = keys.size();
+    }
+    if (end > begin) {
+      result.push_back(keys.substr(begin, end - begin));
+    }
+    begin = end + 1;
+  }
+  return result;
+}
+
+template <class Elf>
+PluginInfos readDescriptors(ElfFile& file)
+{
+  typename Elf::Ehdr header;
+  file.read(0, &header);
+  if (header.e_shoff == 0 || header.e_shnum == 0 || header.e_shstrndx == SHN_UNDEF
+      || header.e_shentsize != sizeof(typename Elf::Shdr)) {
+    return {};
+  }
+
+  std::vector<typename Elf::Shdr> sections(header.e_shnum);
+  file.read(header.e_shoff, sections.data(), sections.size());
+  if (header.e_shstrndx >= sections.size()) {
+    throw PluginDescriptorException("Invalid ELF section table: " + file.getPath());
+  }
+
+  const auto& namesSection = sections[header.e_shstrndx];
+  file.checkRange(namesSection.sh_offset, namesSection.sh_size);
+  std::string names(namesSection.sh_size, '\0');
+  file.read(namesSection.sh_offset, names.data(), names.size());
+
+  PluginInfos infos;
+  for (const auto& section: sections) {
+    if (section.sh_name >= names.size()
+        || std::strcmp(names.c_str() + section.sh_name, DESCRIPTOR_SECTION_NAME) != 0
+        || section.sh_type == SHT_NOBITS) {
+      continue;
+    }
+
+    file.checkRange(section.sh_offset, section.sh_size);
+    std::vector<PluginDescriptor> descriptors(section.sh_size / sizeof(PluginDescriptor));
+    file.read(section.sh_offset, descriptors.data(), descriptors.size());
+    for (const auto& descriptor: descriptors) {
+      if (std::memcmp(descriptor.magic, cppps::PLUGIN_DESCRIPTOR_MAGIC,
+                      sizeof(cppps::PLUGIN_DESCRIPTOR_MAGIC)) != 0
+          || descriptor.size != sizeof(PluginDescriptor)) {
+        throw PluginDescriptorException("Unsupported plugin descriptor: " + file.getPath());
+      }
+      infos.push_back(cppps::toPluginInfo(descriptor));
+    }
+  }
+  return infos;
+}
+
+} // namespace
+
+PluginInfos cppps::readPluginDescriptors(const std::string& path)
+{
+  ElfFile file(path);
+  unsigned char ident[EI_NIDENT];
+  file.read(0, ident, EI_NIDENT);
+  if (std::memcmp(ident, ELFMAG, SELFMAG) != 0) {
+    throw PluginDescriptorException("Not an ELF file: " + path);
+  }
+
+  constexpr auto NATIVE_DATA = (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) ? ELFDATA2LSB
+                                                                          : ELFDATA2MSB;
+  if (ident[EI_DATA] != NATIVE_DATA) {
+    throw PluginDescriptorException("Unsupported ELF byte order: " + path);
+  }
+
+  switch (ident[EI_CLASS]) {
+    case ELFCLASS32:
+      return readDescriptors<Elf32>(file);
+    case ELFCLASS64:
+      return readDescriptors<Elf64>(file);
+    default:
+      throw PluginDescriptorException("Unsupported ELF class: " + path);
+  }
+}
+
+PluginInfo cppps::toPluginInfo(const PluginDescriptor& descriptor)
+{
+  PluginInfo info;
+  info.name = getField(descriptor.name, sizeof(descriptor.name));
+  info.version = getField(descriptor.version, sizeof(descriptor.version));
+  info.providedKeys = splitKeys(getField(descriptor.providedKeys,
+                                         sizeof(descriptor.providedKeys)));
+  info.consumedKeys = splitKeys(getField(descriptor.consumedKeys,
+                                         sizeof(descriptor.consumedKeys)));
+  info.abiVersion = descriptor.abiVersion;
+  return info;
+}
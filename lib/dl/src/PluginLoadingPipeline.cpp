@@ -0,0 +1,79 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "PluginLoadingPipeline.h"
+
+#include <utility>
+
+using cppps::PluginLoadingPipeline;
+
+PluginLoadingPipeline::PluginLoadingPipeline(const Scan& scan, const Load& load)
+{
+  // started once all the members have been initialized
+  thread = std::thread([this, scan, load](){run(scan, load);});
+}
+
+PluginLoadingPipeline::~PluginLoadingPipeline()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    cancelled = true;
+  }
+  thread.join();
+}
+
+cppps::IPluginDPtr PluginLoadingPipeline::next()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  condition.wait(lock, [this](){return !loadedPlugins.empty() || finished;});
+  if (!loadedPlugins.empty()) {
+    auto plugin = std::move(loadedPlugins.front());
+    loadedPlugins.pop_front();
+    return plugin;
+  }
+
+  if (exception) {
+    std::rethrow_exception(std::exchange(exception, nullptr));
+  }
+  return IPluginDPtr(nullptr, nullptr);
+}
+
+PluginLoadingPipeline::Paths PluginLoadingPipeline::getPaths() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return paths;
+}
+
+void PluginLoadingPipeline::run(const Scan& scan, const Load& load)
+{
+  try {
+    auto scannedPaths = scan();
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      paths = scannedPaths;
+    }
+
+    for (const auto& path: scannedPaths) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (cancelled) {
+          break;
+        }
+      }
+
+      auto plugin = load(path);
+      std::lock_guard<std::mutex> lock(mutex);
+      loadedPlugins.push_back(std::move(plugin));
+      condition.notify_one();
+    }
+  }
+  catch (...) {
+    std::lock_guard<std::mutex> lock(mutex);
+    exception = std::current_exception();
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  finished = true;
+  condition.notify_one();
+}
@@ -0,0 +1,72 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef PLUGINLOADINGPIPELINE_H
+#define PLUGINLOADINGPIPELINE_H
+
+#include "cppps/dl/IPlugin.h"
+#include "cppps/dl/PluginCollector.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace cppps {
+
+/**
+ * @brief Plugin scanning and loading running ahead of the consumer.
+ *
+ * A dedicated thread scans for the plugin files and loads them one
+ * by one, while the thread calling next() takes the loaded plugins
+ * (e.g. to prepare them) in the order of the scanned paths. The
+ * destructor stops loading the remaining plugins and joins the thread.
+ */
+class PluginLoadingPipeline
+{
+public:
+  using Paths = PluginCollector::Paths;
+  using Scan = std::function<Paths()>;
+  using Load = std::function<IPluginDPtr(const std::string& path)>;
+
+  PluginLoadingPipeline(const Scan& scan, const Load& load);
+  ~PluginLoadingPipeline();
+
+  PluginLoadingPipeline(const PluginLoadingPipeline&) = delete;
+  PluginLoadingPipeline& operator=(const PluginLoadingPipeline&) = delete;
+
+  /**
+   * @brief Wait for the next loaded plugin
+   *
+   * Rethrows the scanning or loading error once the plugins
+   * loaded before the error have been taken.
+   *
+   * @return Loaded plugin or nullptr if all the plugins have been taken
+   */
+  IPluginDPtr next();
+
+  /**
+   * @brief Get the scanned plugin paths, complete once next() returned nullptr
+   */
+  Paths getPaths() const;
+
+private:
+  mutable std::mutex mutex;
+  std::condition_variable condition;
+  std::deque<IPluginDPtr> loadedPlugins;
+  Paths paths;
+  bool finished {false};
+  bool cancelled {false};
+  std::exception_ptr exception {nullptr};
+  std::thread thread;
+
+private:
+  void run(const Scan& scan, const Load& load);
+};
+
+} // namespace cppps
+
+#endif // PLUGINLOADINGPIPELINE_H
@@ -0,0 +1,175 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "PluginPrefetcher.h"
+#include "cppps/dl/PluginBundle.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux
+#include <linux/fiemap.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#endif
+
+using cppps::PluginPrefetcher;
+
+namespace {
+
+struct DiskLocation
+{
+  bool known {false};
+  uint64_t device {0};
+  bool physical {false}; // the offset is a disk offset, not an inode number
+  uint64_t offset {0};
+
+  bool operator<(const DiskLocation& other) const
+  {
+    // unknown locations go last, inode numbers after disk offsets
+    return std::make_tuple(!known, device, !physical, offset)
+        < std::make_tuple(!other.known, other.device, !other.physical, other.offset);
+  }
+};
+
+#ifndef _WIN32
+class File
+{
+public:
+  explicit File(const std::string& path)
+    : fd{open(path.c_str(), O_RDONLY | O_CLOEXEC)}
+  {
+    // empty
+  }
+
+  ~File()
+  {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+
+  File(const File&) = delete;
+  File& operator=(const File&) = delete;
+
+  int get() const
+  {
+    return fd;
+  }
+
+private:
+  int fd;
+};
+
+std::optional<uint64_t> getPhysicalOffset(int fd)
+{
+#ifdef __linux
+  // the extent holding the start of the file, the ELF headers read first by dlopen
+  alignas(fiemap) unsigned char buffer[sizeof(fiemap) + sizeof(fiemap_extent)] {};
+  auto* map = reinterpret_cast<fiemap*>(buffer);
+  map->fm_start = 0;
+  map->fm_length = FIEMAP_MAX_OFFSET;
+  map->fm_extent_count = 1;
+  if (ioctl(fd, FS_IOC_FIEMAP, map) == 0 && map->fm_mapped_extents > 0
+      && (map->fm_extents[0].fe_flags & FIEMAP_EXTENT_UNKNOWN) == 0) {
+    return map->fm_extents[0].fe_physical;
+  }
+#else
+  (void)fd;
+#endif
+  return std::nullopt;
+}
+
+DiskLocation getDiskLocation(const std::string& path)
+{
+  File file(path);
+  struct stat status;
+  if (file.get() < 0 || fstat(file.get(), &status) != 0) {
+    return {};
+  }
+  // inodes are usually allocated close to their data
+  auto physicalOffset = getPhysicalOffset(file.get());
+  return {true, static_cast<uint64_t>(status.st_dev), physicalOffset.has_value(),
+          physicalOffset.value_or(static_cast<uint64_t>(status.st_ino))};
+}
+
+void adviseWillNeed(const std::string& path)
+{
+  File file(path);
+  if (file.get() >= 0) {
+    posix_fadvise(file.get(), 0, 0, POSIX_FADV_WILLNEED);
+  }
+}
+#else
+DiskLocation getDiskLocation(const std::string&)
+{
+  return {};
+}
+#endif
+
+} // namespace
+
+PluginPrefetcher::~PluginPrefetcher()
+{
+  if (thread.joinable()) {
+    thread.join();
+  }
+}
+
+void PluginPrefetcher::prefetch(const Paths& paths)
+{
+#ifndef _WIN32
+  if (thread.joinable()) {
+    thread.join();
+  }
+  // the bundled plugins are read with their bundle
+  Paths filePaths;
+  std::set<std::string> bundlePaths;
+  for (const auto& path: paths) {
+    auto bundleEntry = splitBundleEntryPath(path);
+    if (!bundleEntry || std::filesystem::exists(path)) {
+      filePaths.push_back(path);
+    }
+    else if (bundlePaths.insert(bundleEntry->first).second) {
+      filePaths.push_back(bundleEntry->first);
+    }
+  }
+
+  thread = std::thread([filePaths = std::move(filePaths)](){
+    for (const auto& path: sortByDiskLocation(filePaths)) {
+      adviseWillNeed(path);
+    }
+  });
+#else
+  (void)paths;
+#endif
+}
+
+PluginPrefetcher::Paths PluginPrefetcher::sortByDiskLocation(const Paths& paths)
+{
+  std::vector<std::pair<DiskLocation, std::string>> locatedPaths;
+  for (const auto& path: paths) {
+    locatedPaths.emplace_back(getDiskLocation(path), path);
+  }
+  std::stable_sort(locatedPaths.begin(), locatedPaths.end(), [](const auto& lhs, const auto& rhs){
+    return lhs.first < rhs.first;
+  });
+
+  Paths sortedPaths;
+  for (auto& [location, path]: locatedPaths) {
+    sortedPaths.push_back(std::move(path));
+  }
+  return sortedPaths;
+}
@@ -0,0 +1,54 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef PLUGINPREFETCHER_H
+#define PLUGINPREFETCHER_H
+
+#include "cppps/dl/PluginCollector.h"
+
+#include <thread>
+
+namespace cppps {
+
+/**
+ * @brief Background readahead of the plugin files.
+ *
+ * On a cold page cache the dynamic linker faults the plugin images in
+ * with many small random reads. The prefetcher asks the kernel to read
+ * the whole files ahead (posix_fadvise WILLNEED), walking them in the
+ * order of their on-disk location, so the reads are issued before and
+ * while the plugins are being loaded. Errors are ignored: a file that
+ * cannot be prefetched is simply read on demand. No-op on Windows.
+ */
+class PluginPrefetcher
+{
+public:
+  using Paths = PluginCollector::Paths;
+
+  PluginPrefetcher() = default;
+  ~PluginPrefetcher();
+
+  PluginPrefetcher(const PluginPrefetcher&) = delete;
+  PluginPrefetcher& operator=(const PluginPrefetcher&) = delete;
+
+  /**
+   * @brief Start prefetching the files on a background thread
+   */
+  void prefetch(const Paths& paths);
+
+  /**
+   * @brief Order the files by device and physical offset of their first block
+   *
+   * Falls back to the inode number where the block mapping is unavailable;
+   * files that cannot be examined go last, in the given order.
+   */
+  static Paths sortByDiskLocation(const Paths& paths);
+
+private:
+  std::thread thread;
+};
+
+} // namespace cppps
+
+#endif // PLUGINPREFETCHER_H
@@ -0,0 +1,217 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/PluginSelection.h"
+
+#include <algorithm>
+#include <fstream>
+
+using cppps::PluginSelection;
+
+namespace {
+
+constexpr std::string_view CONFIG_OPTION = "--config";
+constexpr std::string_view CONFIG_SHORT_OPTION = "-c";
+constexpr std::string_view END_OF_OPTIONS = "--";
+constexpr auto WHITESPACE = " \t\r\n";
+constexpr auto QUOTES = "\"'";
+
+std::string_view trim(std::string_view text, const char* characters = WHITESPACE)
+{
+  auto begin = text.find_first_not_of(characters);
+  if (begin == std::string_view::npos) {
+    return {};
+  }
+  auto end = text.find_last_not_of(characters);
+  return text.substr(begin, end - begin + 1);
+}
+
+bool startsWith(std::string_view text, std::string_view prefix)
+{
+  return text.substr(0, prefix.size()) == prefix;
+}
+
+/**
+ * @brief Read the value of "--option value" or "--option=value"
+ */
+bool readOptionValue(std::string_view option, int argc, char** argv,
+                     int& index, std::string& value)
+{
+  std::string_view arg = argv[index];
+  if (arg == option) {
+    if (index + 1 < argc) {
+      value = argv[++index];
+      return true;
+    }
+    return false;
+  }
+  if (startsWith(arg, option) && arg.size() > option.size() && arg[option.size()] == '=') {
+    value = arg.substr(option.size() + 1);
+    return true;
+  }
+  return false;
+}
+
+bool readShortOptionValue(std::string_view option, int argc, char** argv,
+                          int& index, std::string& value)
+{
+  std::string_view arg = argv[index];
+  if (startsWith(arg, option) && arg.size() > option.size()) {
+    value = arg.substr(option.size());
+    return true;
+  }
+  return readOptionValue(option, argc, argv, index, value);
+}
+
+bool matchPattern(std::string_view pattern, std::string_view name)
+{
+  // iterative wildcard matching, backtracking to the last '*'
+  size_t patternPos = 0;
+  size_t namePos = 0;
+  auto starPos = std::string_view::npos;
+  size_t starNamePos = 0;
+  while (namePos < name.size()) {
+    if (patternPos < pattern.size()
+        && (pattern[patternPos] == '?' || pattern[patternPos] == name[namePos])) {
+      ++patternPos;
+      ++namePos;
+    }
+    else if (patternPos < pattern.size() && pattern[patternPos] == '*') {
+      starPos = patternPos++;
+      starNamePos = namePos;
+    }
+    else if (starPos != std::string_view::npos) {
+      patternPos = starPos + 1;
+      namePos = ++starNamePos;
+    }
+    else {
+      return false;
+    }
+  }
+  while (patternPos < pattern.size() && pattern[patternPos] == '*') {
+    ++patternPos;
+  }
+  return patternPos == pattern.size();
+}
+
+bool matchAny(const PluginSelection::Patterns& patterns, std::string_view name)
+{
+  return std::any_of(patterns.begin(), patterns.end(), [name](const auto& pattern){
+    return matchPattern(pattern, name);
+  });
+}
+
+void appendPatterns(PluginSelection::Patterns& patterns, std::string_view text)
+{
+  size_t begin = 0;
+  while (begin <= text.size()) {
+    auto end = std::min(text.find(',', begin), text.size());
+    auto pattern = trim(trim(text.substr(begin, end - begin)), QUOTES);
+    if (!pattern.empty()) {
+      patterns.emplace_back(pattern);
+    }
+    begin = end + 1;
+  }
+}
+
+} // namespace
+
+void PluginSelection::parse(int argc, char** argv)
+{
+  std::string configPath;
+  PluginSelection cliSelection;
+  bool includesGiven = false;
+  bool excludesGiven = false;
+
+  for (int i = 1; i < argc; ++i) {
+    if (argv[i] == END_OF_OPTIONS) {
+      break;
+    }
+
+    std::string value;
+    if (readOptionValue(PLUGINS_OPTION, argc, argv, i, value)) {
+      cliSelection.addIncludePatterns(value);
+      includesGiven = true;
+    }
+    else if (readOptionValue(DISABLE_PLUGINS_OPTION, argc, argv, i, value)) {
+      cliSelection.addExcludePatterns(value);
+      excludesGiven = true;
+    }
+    else if (readOptionValue(CONFIG_OPTION, argc, argv, i, value)
+             || readShortOptionValue(CONFIG_SHORT_OPTION, argc, argv, i, value)) {
+      configPath = value;
+    }
+  }
+
+  if (!configPath.empty()) {
+    parseConfigFile(configPath);
+  }
+
+  // the command line overrides the config file
+  if (includesGiven) {
+    includePatterns = cliSelection.includePatterns;
+  }
+  if (excludesGiven) {
+    excludePatterns = cliSelection.excludePatterns;
+  }
+}
+
+void PluginSelection::addIncludePatterns(std::string_view patterns)
+{
+  appendPatterns(includePatterns, patterns);
+}
+
+void PluginSelection::addExcludePatterns(std::string_view patterns)
+{
+  appendPatterns(excludePatterns, patterns);
+}
+
+bool PluginSelection::isRestricted() const
+{
+  return !includePatterns.empty() || !excludePatterns.empty();
+}
+
+bool PluginSelection::isSelected(std::string_view pluginName) const
+{
+  if (!includePatterns.empty() && !matchAny(includePatterns, pluginName)) {
+    return false;
+  }
+  return !matchAny(excludePatterns, pluginName);
+}
+
+void PluginSelection::parseConfigFile(const std::string& path)
+{
+  // a missing or malformed file is reported by the Cli later on
+  std::ifstream file(path);
+  std::string line;
+  bool defaultSection = true;
+  auto pluginsKey = std::string_view(PLUGINS_OPTION).substr(2);
+  auto disablePluginsKey = std::string_view(DISABLE_PLUGINS_OPTION).substr(2);
+
+  while (std::getline(file, line)) {
+    auto text = trim(line);
+    if (text.empty() || text.front() == ';' || text.front() == '#') {
+      continue;
+    }
+    if (text.front() == '[') {
+      auto section = trim(text.substr(1, text.find(']') - 1));
+      defaultSection = section.empty() || section == "default";
+      continue;
+    }
+
+    auto separator = text.find('=');
+    if (!defaultSection || separator == std::string_view::npos) {
+      continue;
+    }
+
+    auto key = trim(text.substr(0, separator));
+    auto value = trim(trim(text.substr(separator + 1)), "[]");
+    if (key == pluginsKey) {
+      addIncludePatterns(value);
+    }
+    else if (key == disablePluginsKey) {
+      addExcludePatterns(value);
+    }
+  }
+}
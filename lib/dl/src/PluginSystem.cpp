@@ -4,11 +4,19 @@
 
 #include "cppps/dl/PluginSystem.h"
 #include "cppps/dl/Digraph.h"
+#include "cppps/dl/DigraphScheduler.h"
 #include "cppps/dl/exceptions.h"
 
+#include <algorithm>
 #include <map>
 #include <any>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
 
 using namespace cppps;
 
@@ -27,16 +35,92 @@ struct PluginHandle
 
 using PluginDigraph = Digraph<std::string, PluginHandle>;
 
+struct TimedPlugin
+{
+  std::string name;
+  std::chrono::microseconds duration;
+};
+
+using TimedPluginDigraph = Digraph<std::string, TimedPlugin>;
+using PluginPtrDigraph = Digraph<std::string, IPluginDPtr*>;
+using PluginScheduler = DigraphScheduler<std::string, IPluginDPtr*>;
+
+using Dependencies = std::map<std::string /*plugin name*/, std::set<std::string>>;
+using ProviderOrigins = std::map<std::string /*resource key*/, std::string /*plugin name*/>;
+using PluginPtrs = std::vector<IPluginDPtr*>;
+using Durations = std::map<std::string /*plugin name*/, std::chrono::microseconds>;
+
+constexpr size_t MAX_PHASE_THREADS = 64;
+
+/**
+ * Reports the plugins exceeding their stop deadlines
+ * while their stop() methods are still running.
+ */
+class StopWatchdog
+{
+public:
+  explicit StopWatchdog(const PluginSystem::OnStopDeadlineExceededHook& hook);
+  ~StopWatchdog();
+
+  void watch(const std::string& pluginName, std::chrono::milliseconds deadline);
+  void release(const std::string& pluginName);
+
+private:
+  struct Watch
+  {
+    std::chrono::steady_clock::time_point deadlineTime;
+    std::chrono::milliseconds deadline;
+    bool reported;
+  };
+
+  PluginSystem::OnStopDeadlineExceededHook hook;
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::map<std::string, Watch> watches;
+  bool finished {false};
+  std::thread thread;
+
+private:
+  void run();
+};
+
+/**
+ * Creates a graph of the given plugins with the edges
+ * going from the consumers to their providers.
+ */
+PluginPtrDigraph makePluginDigraph(const PluginPtrs& plugins,
+                                   const Dependencies& pluginProviders);
+
+/**
+ * Moves the started plugins following the first startedCount ones
+ * before the plugins which have not been started, keeping their order.
+ *
+ * @return Number of the started plugins at the front of the list
+ */
+size_t moveStartedPluginsFirst(PluginSystem::LoadedPlugins& plugins, size_t startedCount,
+                               const std::set<const IPluginDPtr*>& startedPlugins);
+
 class PluginInitializer
 {
 public:
+  PluginInitializer(const ResourceRegistry::Resources& resources,
+                    const ProviderOrigins& providerOrigins);
+
   void initializePlugins(PluginSystem::LoadedPlugins& uninitializedPlugins,
                          PluginSystem::LoadedPlugins& initializedPlugins);
 
+  const ResourceRegistry::Resources& getResources() const;
+  const ProviderOrigins& getProviderOrigins() const;
+  const Dependencies& getDependencies() const;
+  const Durations& getDurations() const;
+
 private:
-  std::map<std::string, Resource> resources;
-  std::map<std::string /*resource key*/,
-           std::string /*source*/> providerOrigins;
+  ResourceRegistry::Resources resources;
+  ProviderOrigins providerOrigins;
+  std::set<std::string> pluginNames;
+
+  Dependencies dependencies;
+  Durations durations;
 
   PluginDigraph graph {
     ([](const auto& pluginHandle) {
@@ -79,40 +163,518 @@ void PluginSystem::prepare(const ICliPtr& cli, IApplication& app)
 
 void PluginSystem::initialize()
 {
-  PluginInitializer initializer;
-  initializer.initializePlugins(uninitializedPlugins, initializedPlugins);
+  for (const auto& plugin: uninitializedPlugins) {
+    for (const auto& initializedPlugin: initializedPlugins) {
+      if (initializedPlugin->getName() == plugin->getName()) {
+        auto message = "Plugin '" + plugin->getName() + "' has already been initialized";
+        uninitializedPlugins.clear();
+        throw DuplicatedPluginException(message);
+      }
+    }
+  }
+
+  try {
+    initializePlugins(uninitializedPlugins);
+  }
+  catch (...) {
+    // the plugins failing to initialize are dropped
+    uninitializedPlugins.clear();
+    throw;
+  }
   uninitializedPlugins.clear();
 }
 
 void PluginSystem::start()
 {
-  for (auto& plugin: initializedPlugins) {
-    plugin->start();
+  // only the plugins initialized since the last start
+  auto firstPlugin = std::next(initializedPlugins.begin(), startedPluginCount);
+  if (lifecycleMode == LifecycleMode::SERIAL) {
+    for (auto it = firstPlugin; it != initializedPlugins.end(); ++it) {
+      (*it)->start();
+      ++startedPluginCount;
+    }
+    return;
+  }
+
+  PluginPtrs plugins;
+  for (auto it = firstPlugin; it != initializedPlugins.end(); ++it) {
+    plugins.push_back(&*it);
+  }
+
+  // the skipped and failed plugins are started by the next start()
+  std::mutex startedMutex;
+  std::set<const IPluginDPtr*> startedPlugins;
+  auto graph = makePluginDigraph(plugins, pluginProviders);
+  PluginScheduler scheduler(graph, PluginScheduler::Order::DEPENDENCIES_FIRST);
+  scheduler.setThreadCount(std::min(plugins.size(), MAX_PHASE_THREADS));
+  scheduler.setTimeout(phaseTimeout, PluginScheduler::TimeoutPolicy::SKIP);
+  PluginScheduler::Keys skippedPlugins;
+  try {
+    skippedPlugins = scheduler.run([&](auto* plugin, bool){
+      (*plugin)->start();
+      std::lock_guard<std::mutex> lock(startedMutex);
+      startedPlugins.insert(plugin);
+    });
+  }
+  catch (...) {
+    startedPluginCount = moveStartedPluginsFirst(initializedPlugins, startedPluginCount,
+                                                 startedPlugins);
+    throw;
+  }
+  startedPluginCount = moveStartedPluginsFirst(initializedPlugins, startedPluginCount,
+                                               startedPlugins);
+  if (!skippedPlugins.empty()) {
+    std::ostringstream message;
+    message << "Starting the plugins has timed out after " << phaseTimeout.count()
+            << " ms; not started:";
+    for (const auto& name: skippedPlugins) {
+      message << " " << name;
+    }
+    throw LifecycleTimeoutException(message.str());
   }
 }
 
 void PluginSystem::stop()
 {
-  for (auto it = initializedPlugins.rbegin();
-       it != initializedPlugins.rend(); ++it) {
-    (*it)->stop();
+  startedPluginCount = 0;
+  stopPlugins(initializedPlugins);
+}
+
+void PluginSystem::stopPlugins(LoadedPlugins& plugins)
+{
+  using std::chrono::milliseconds;
+  using std::chrono::steady_clock;
+
+  std::unique_ptr<StopWatchdog> watchdog;
+  if (onStopDeadlineExceededHook
+      && (defaultStopDeadline.count() > 0 || !stopDeadlines.empty())) {
+    watchdog = std::make_unique<StopWatchdog>(onStopDeadlineExceededHook);
+  }
+
+  stopReport.clear();
+  std::mutex reportMutex;
+  auto stopPlugin = [&](IPluginDPtr& plugin, bool forced) {
+    auto name = plugin->getName();
+    auto deadline = getStopDeadline(name);
+    if (watchdog && deadline.count() > 0) {
+      watchdog->watch(name, deadline);
+    }
+
+    auto start = steady_clock::now();
+    plugin->stop();
+    auto duration = std::chrono::duration_cast<milliseconds>(steady_clock::now() - start);
+
+    if (watchdog) {
+      watchdog->release(name);
+    }
+    {
+      std::lock_guard<std::mutex> lock(reportMutex);
+      stopReport.push_back({name, duration, deadline,
+                            deadline.count() > 0 && duration > deadline, forced});
+    }
+
+    for (auto& [id, hook]: onPluginStoppedHooks) {
+      hook(name);
+    }
+  };
+
+  if (lifecycleMode == LifecycleMode::SERIAL) {
+    for (auto it = plugins.rbegin(); it != plugins.rend(); ++it) {
+      stopPlugin(*it, false);
+    }
+    return;
   }
+
+  PluginPtrs pluginPtrs;
+  for (auto& plugin: plugins) {
+    pluginPtrs.push_back(&plugin);
+  }
+
+  // a plugin waits for all its consumers
+  auto graph = makePluginDigraph(pluginPtrs, pluginProviders);
+  PluginScheduler scheduler(graph, PluginScheduler::Order::DEPENDENTS_FIRST);
+  scheduler.setThreadCount(std::min(pluginPtrs.size(), MAX_PHASE_THREADS));
+  scheduler.setTimeout(phaseTimeout, PluginScheduler::TimeoutPolicy::FORCE);
+  scheduler.run([&stopPlugin](auto* plugin, bool forced){stopPlugin(*plugin, forced);});
 }
 
 void PluginSystem::unload()
 {
+  resourceRegistry.clear();
+  resources.clear();
+  providerOrigins.clear();
+  pluginProviders.clear();
+  initDurations.clear();
+  startedPluginCount = 0;
   for (auto it = initializedPlugins.rbegin();
        it != initializedPlugins.rend(); ++it) {
     (*it)->unload();
     (*it) = nullptr; // preserve destroying order
   }
   initializedPlugins.clear();
+  replacedPlugins.clear();
+}
+
+void PluginSystem::reload(IPluginDPtr&& plugin, const ICliPtr& cli, IApplication& app)
+{
+  const auto pluginName = plugin->getName();
+  auto replacedIt = std::find_if(initializedPlugins.begin(), initializedPlugins.end(),
+                                 [&pluginName](const auto& initializedPlugin){
+    return initializedPlugin->getName() == pluginName;
+  });
+  if (replacedIt == initializedPlugins.end()) {
+    throw PluginReloadException("Cannot reload plugin '" + pluginName + "': not initialized");
+  }
+
+  // the subgraph keeps the dependency order of the initialized plugins
+  auto dependentPlugins = getDependentPlugins(pluginName);
+  LoadedPlugins subgraph;
+  std::vector<std::string> subgraphOrder;
+  for (auto it = initializedPlugins.begin(); it != initializedPlugins.end();) {
+    auto next = std::next(it);
+    if (dependentPlugins.count((*it)->getName()) > 0) {
+      subgraphOrder.push_back((*it)->getName());
+      subgraph.splice(subgraph.end(), initializedPlugins, it);
+    }
+    it = next;
+  }
+  const auto runningPluginCount = initializedPlugins.size();
+  startedPluginCount = runningPluginCount;
+  stopPlugins(subgraph);
+  withdrawResources(dependentPlugins);
+
+  // the replaced plugin is kept until the new subgraph is running
+  auto newPluginIt = std::find_if(subgraph.begin(), subgraph.end(),
+                                  [&pluginName](const auto& subgraphPlugin){
+    return subgraphPlugin->getName() == pluginName;
+  });
+  auto replacedPlugin = std::exchange(*newPluginIt, std::move(plugin));
+  auto* newPlugin = newPluginIt->get();
+
+  const auto withdrawnResources = resources;
+  const auto withdrawnProviderOrigins = providerOrigins;
+  const auto withdrawnPluginProviders = pluginProviders;
+  try {
+    newPlugin->prepare(cli, app);
+    initializePlugins(subgraph);
+    start();
+  }
+  catch (...) {
+    auto error = std::current_exception();
+
+    // the new subgraph is stopped and taken apart
+    LoadedPlugins failedPlugins;
+    failedPlugins.splice(failedPlugins.end(), initializedPlugins,
+                         std::next(initializedPlugins.begin(), runningPluginCount),
+                         initializedPlugins.end());
+    startedPluginCount = runningPluginCount;
+    stopPlugins(failedPlugins);
+    failedPlugins.splice(failedPlugins.end(), subgraph);
+
+    std::set<std::string> failedKeys;
+    for (const auto& [key, resource]: resources) {
+      if (withdrawnResources.count(key) == 0) {
+        failedKeys.insert(key);
+      }
+    }
+    resourceRegistry.remove(failedKeys);
+    resources = withdrawnResources;
+    providerOrigins = withdrawnProviderOrigins;
+    pluginProviders = withdrawnPluginProviders;
+
+    // the consumers go back to the replaced plugin
+    LoadedPlugins restoredPlugins;
+    for (const auto& name: subgraphOrder) {
+      if (name == pluginName) {
+        restoredPlugins.push_back(std::move(replacedPlugin));
+        continue;
+      }
+      auto it = std::find_if(failedPlugins.begin(), failedPlugins.end(),
+                             [&name, newPlugin](const auto& failedPlugin){
+        return failedPlugin && failedPlugin.get() != newPlugin && failedPlugin->getName() == name;
+      });
+      restoredPlugins.push_back(std::move(*it));
+    }
+    for (auto& failedPlugin: failedPlugins) {
+      if (failedPlugin) {
+        failedPlugin->unload();
+        replacedPlugins.push_back(std::move(failedPlugin));
+      }
+    }
+
+    try {
+      initializePlugins(restoredPlugins);
+      start();
+    }
+    catch (...) {
+      // the published resources may still refer to their code
+      for (auto& restoredPlugin: restoredPlugins) {
+        if (restoredPlugin) {
+          restoredPlugin->unload();
+          replacedPlugins.push_back(std::move(restoredPlugin));
+        }
+      }
+      throw;
+    }
+    std::rethrow_exception(error);
+  }
+
+  replacedPlugin->unload();
+  replacedPlugins.push_back(std::move(replacedPlugin));
+}
+
+const ResourceRegistry& PluginSystem::getResourceRegistry() const
+{
+  return resourceRegistry;
+}
+
+PluginSystem::HookId PluginSystem::addOnPluginStoppedHook(const OnPluginStoppedHook& hook)
+{
+  // the ids grow, so the hooks are called in the order of addition
+  auto id = nextHookId++;
+  onPluginStoppedHooks.emplace(id, hook);
+  return id;
+}
+
+void PluginSystem::removeOnPluginStoppedHook(HookId id)
+{
+  onPluginStoppedHooks.erase(id);
+}
+
+void PluginSystem::setDefaultStopDeadline(std::chrono::milliseconds deadline)
+{
+  defaultStopDeadline = deadline;
+}
+
+void PluginSystem::setStopDeadline(const std::string& pluginName,
+                                   std::chrono::milliseconds deadline)
+{
+  stopDeadlines[pluginName] = deadline;
+}
+
+void PluginSystem::setOnStopDeadlineExceededHook(const OnStopDeadlineExceededHook& hook)
+{
+  onStopDeadlineExceededHook = hook;
+}
+
+const PluginSystem::StopReport& PluginSystem::getStopReport() const
+{
+  return stopReport;
+}
+
+PluginSystem::StartupReport PluginSystem::getStartupReport() const
+{
+  using std::chrono::microseconds;
+
+  TimedPluginDigraph graph([](const auto& plugin){return plugin.name;});
+  std::set<std::string> pluginNames;
+  for (const auto& plugin: initializedPlugins) {
+    auto durationIt = initDurations.find(plugin->getName());
+    graph.addNode({plugin->getName(), (durationIt != initDurations.end())
+                   ? durationIt->second : microseconds(0)});
+    pluginNames.insert(plugin->getName());
+  }
+
+  Dependencies providersOf;
+  for (const auto& [consumer, providers]: pluginProviders) {
+    for (const auto& provider: providers) {
+      if (pluginNames.count(consumer) > 0 && pluginNames.count(provider) > 0) {
+        graph.addEdge(consumer, provider);
+        providersOf[consumer].insert(provider);
+      }
+    }
+  }
+
+  // forward pass: a plugin starts when its last provider finishes
+  auto sortedPlugins = graph.topologicalSort();
+  StartupReport report {{}, {}, microseconds(0), microseconds(0)};
+  std::map<std::string, microseconds> earliestFinish;
+  std::map<std::string, std::string> criticalProviders;
+  std::string lastPlugin;
+  for (const auto& plugin: sortedPlugins) {
+    microseconds earliestStart(0);
+    for (const auto& provider: providersOf[plugin.name]) {
+      if (earliestFinish[provider] > earliestStart) {
+        earliestStart = earliestFinish[provider];
+        criticalProviders[plugin.name] = provider;
+      }
+    }
+    earliestFinish[plugin.name] = earliestStart + plugin.duration;
+    report.serialTime += plugin.duration;
+    if (lastPlugin.empty() || earliestFinish[plugin.name] > report.parallelTime) {
+      report.parallelTime = earliestFinish[plugin.name];
+      lastPlugin = plugin.name;
+    }
+  }
+
+  // backward pass: a provider has to finish before its consumers' latest start
+  std::map<std::string, microseconds> latestFinish;
+  for (const auto& plugin: sortedPlugins) {
+    latestFinish[plugin.name] = report.parallelTime;
+  }
+  for (auto it = sortedPlugins.rbegin(); it != sortedPlugins.rend(); ++it) {
+    auto latestStart = latestFinish[it->name] - it->duration;
+    for (const auto& provider: providersOf[it->name]) {
+      latestFinish[provider] = std::min(latestFinish[provider], latestStart);
+    }
+  }
+
+  for (const auto& plugin: sortedPlugins) {
+    auto slack = latestFinish[plugin.name] - earliestFinish[plugin.name];
+    report.plugins.push_back({plugin.name, plugin.duration,
+                              earliestFinish[plugin.name] - plugin.duration,
+                              slack, slack.count() == 0});
+  }
+
+  for (auto name = lastPlugin; !name.empty();) {
+    report.criticalPath.push_front(name);
+    auto it = criticalProviders.find(name);
+    name = (it != criticalProviders.end()) ? it->second : std::string();
+  }
+  return report;
+}
+
+void PluginSystem::setLifecycleMode(LifecycleMode mode)
+{
+  lifecycleMode = mode;
+}
+
+void PluginSystem::setPhaseTimeout(std::chrono::milliseconds timeout)
+{
+  phaseTimeout = timeout;
+}
+
+void PluginSystem::initializePlugins(LoadedPlugins& plugins)
+{
+  auto firstPlugin = initializedPlugins.size();
+  PluginInitializer initializer(resources, providerOrigins);
+  std::exception_ptr error {nullptr};
+  try {
+    initializer.initializePlugins(plugins, initializedPlugins);
+  }
+  catch (...) {
+    error = std::current_exception();
+  }
+
+  // the plugins initialized before a failure stay initialized,
+  // so their resources and providers are committed as well
+  resources = initializer.getResources();
+  providerOrigins.clear();
+  for (const auto& [key, pluginName]: initializer.getProviderOrigins()) {
+    if (resources.count(key) > 0) {
+      providerOrigins.emplace(key, pluginName);
+    }
+  }
+  const auto& dependencies = initializer.getDependencies();
+  for (auto it = std::next(initializedPlugins.begin(), firstPlugin);
+       it != initializedPlugins.end(); ++it) {
+    auto dependencyIt = dependencies.find((*it)->getName());
+    if (dependencyIt != dependencies.end()) {
+      pluginProviders[dependencyIt->first] = dependencyIt->second;
+    }
+  }
+  for (const auto& [pluginName, duration]: initializer.getDurations()) {
+    initDurations[pluginName] = duration;
+  }
+  resourceRegistry.publish(resources);
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void PluginSystem::withdrawResources(const std::set<std::string>& pluginNames)
+{
+  std::set<std::string> withdrawnKeys;
+  for (auto it = providerOrigins.begin(); it != providerOrigins.end();) {
+    if (pluginNames.count(it->second) > 0) {
+      withdrawnKeys.insert(it->first);
+      resources.erase(it->first);
+      it = providerOrigins.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+  for (const auto& name: pluginNames) {
+    pluginProviders.erase(name);
+  }
+  resourceRegistry.remove(withdrawnKeys);
+}
+
+std::set<std::string> PluginSystem::getDependentPlugins(const std::string& pluginName)
+{
+  PluginPtrs plugins;
+  for (auto& plugin: initializedPlugins) {
+    plugins.push_back(&plugin);
+  }
+
+  auto graph = makePluginDigraph(plugins, pluginProviders);
+  auto consumers = graph.getAncestors(pluginName);
+  std::set<std::string> dependentPlugins(consumers.begin(), consumers.end());
+  dependentPlugins.insert(pluginName);
+  return dependentPlugins;
+}
+
+std::chrono::milliseconds PluginSystem::getStopDeadline(const std::string& pluginName) const
+{
+  auto it = stopDeadlines.find(pluginName);
+  return (it != stopDeadlines.end()) ? it->second : defaultStopDeadline;
 }
 
 // -------------------
 
 namespace {
 
+PluginPtrDigraph makePluginDigraph(const PluginPtrs& plugins,
+                                   const Dependencies& pluginProviders)
+{
+  PluginPtrDigraph graph([](const auto* plugin){return (*plugin)->getName();});
+  std::set<std::string> pluginNames;
+  for (auto* plugin: plugins) {
+    graph.addNode(plugin);
+    pluginNames.insert((*plugin)->getName());
+  }
+
+  // the providers outside of the graph need no ordering
+  for (const auto& [consumer, providers]: pluginProviders) {
+    if (pluginNames.count(consumer) == 0) {
+      continue;
+    }
+    for (const auto& provider: providers) {
+      if (pluginNames.count(provider) > 0) {
+        graph.addEdge(consumer, provider);
+      }
+    }
+  }
+  return graph;
+}
+
+size_t moveStartedPluginsFirst(PluginSystem::LoadedPlugins& plugins, size_t startedCount,
+                               const std::set<const IPluginDPtr*>& startedPlugins)
+{
+  // the providers of a started plugin have been started,
+  // so the dependency order of the list is kept
+  PluginSystem::LoadedPlugins notStartedPlugins;
+  for (auto it = std::next(plugins.begin(), startedCount); it != plugins.end();) {
+    auto next = std::next(it);
+    if (startedPlugins.count(&*it) == 0) {
+      notStartedPlugins.splice(notStartedPlugins.end(), plugins, it);
+    }
+    it = next;
+  }
+  auto count = plugins.size();
+  plugins.splice(plugins.end(), notStartedPlugins);
+  return count;
+}
+
+PluginInitializer::PluginInitializer(const ResourceRegistry::Resources& resources,
+                                     const ProviderOrigins& providerOrigins)
+  : resources{resources}, providerOrigins{providerOrigins}
+{
+  // empty
+}
+
 void PluginInitializer::initializePlugins(PluginSystem::LoadedPlugins& uninitializedPlugins,
                        PluginSystem::LoadedPlugins& initializedPlugins)
 {
@@ -122,6 +684,26 @@ void PluginInitializer::initializePlugins(PluginSystem::LoadedPlugins& uninitial
   initializePlugins(initializedPlugins);
 }
 
+const ResourceRegistry::Resources& PluginInitializer::getResources() const
+{
+  return resources;
+}
+
+const ProviderOrigins& PluginInitializer::getProviderOrigins() const
+{
+  return providerOrigins;
+}
+
+const Dependencies& PluginInitializer::getDependencies() const
+{
+  return dependencies;
+}
+
+const Durations& PluginInitializer::getDurations() const
+{
+  return durations;
+}
+
 void PluginInitializer::addGraphNodes(PluginSystem::LoadedPlugins& plugins)
 {
   for (auto& plugin: plugins) {
@@ -142,6 +724,7 @@ void PluginInitializer::addGraphNodes(PluginSystem::LoadedPlugins& plugins)
       providerOrigins.emplace(std::get<0>(provider), plugin->getName());
     }
     graph.addNode(PluginHandle{plugin, handleProviders, handleConsumers});
+    pluginNames.insert(plugin->getName());
   }
 }
 
@@ -156,7 +739,11 @@ void PluginInitializer::addGraphEdges(PluginSystem::LoadedPlugins& plugins)
                                             + key + "' required by plugin '"
                                             + plugin->getName() + "' not found");
       }
-      graph.addEdge(plugin->getName(), providerOriginIt->second);
+      // the already initialized providers need no ordering
+      if (pluginNames.count(providerOriginIt->second) > 0) {
+        graph.addEdge(plugin->getName(), providerOriginIt->second);
+      }
+      dependencies[plugin->getName()].insert(providerOriginIt->second);
     }
   }
 }
@@ -185,6 +772,8 @@ void PluginInitializer::initializePlugins(PluginSystem::LoadedPlugins& orderedPl
   auto sortedPlugins = graph.topologicalSort();
   for (auto& handle: sortedPlugins) {
     auto& plugin = handle.plugin;
+    auto pluginName = plugin->getName();
+    auto start = std::chrono::steady_clock::now();
 
     for (auto& [key, consumer]: handle.consumers) {
       consumer(resources.at(key));
@@ -196,8 +785,78 @@ void PluginInitializer::initializePlugins(PluginSystem::LoadedPlugins& orderedPl
       resources.emplace(key, provider());
     }
 
+    durations[pluginName] = std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start);
     orderedPlugins.emplace_back(std::move(plugin));
   }
 }
 
 } // namespace
+
+namespace {
+
+StopWatchdog::StopWatchdog(const PluginSystem::OnStopDeadlineExceededHook& hook)
+  : hook{hook}
+{
+  thread = std::thread([this](){run();});
+}
+
+StopWatchdog::~StopWatchdog()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    finished = true;
+  }
+  changed.notify_one();
+  thread.join();
+}
+
+void StopWatchdog::watch(const std::string& pluginName, std::chrono::milliseconds deadline)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    watches[pluginName] = {std::chrono::steady_clock::now() + deadline, deadline, false};
+  }
+  changed.notify_one();
+}
+
+void StopWatchdog::release(const std::string& pluginName)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    watches.erase(pluginName);
+  }
+  changed.notify_one();
+}
+
+void StopWatchdog::run()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  while (!finished) {
+    auto next = watches.end();
+    for (auto it = watches.begin(); it != watches.end(); ++it) {
+      if (!it->second.reported
+          && (next == watches.end() || it->second.deadlineTime < next->second.deadlineTime)) {
+        next = it;
+      }
+    }
+
+    if (next == watches.end()) {
+      changed.wait(lock);
+    }
+    else if (next->second.deadlineTime <= std::chrono::steady_clock::now()) {
+      // report once per plugin
+      next->second.reported = true;
+      auto name = next->first;
+      auto deadline = next->second.deadline;
+      lock.unlock();
+      hook(name, deadline);
+      lock.lock();
+    }
+    else {
+      changed.wait_until(lock, next->second.deadlineTime);
+    }
+  }
+}
+
+} // namespace
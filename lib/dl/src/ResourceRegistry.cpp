@@ -0,0 +1,75 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/ResourceRegistry.h"
+
+using cppps::ResourceRegistry;
+using cppps::Resource;
+
+ResourceRegistry::ResourceRegistry()
+{
+  snapshots.push_back({0, {}});
+  snapshot.store(&snapshots.back(), std::memory_order_release);
+}
+
+ResourceRegistry::~ResourceRegistry() = default;
+
+void ResourceRegistry::publish(const Resources& resources)
+{
+  std::lock_guard<std::mutex> lock(updateMutex);
+  const auto* current = snapshot.load(std::memory_order_relaxed);
+
+  Snapshot next {current->version + 1, current->resources};
+  for (const auto& [key, resource]: resources) {
+    next.resources.insert_or_assign(key, resource);
+  }
+
+  snapshots.push_back(std::move(next));
+  snapshot.store(&snapshots.back(), std::memory_order_release);
+}
+
+void ResourceRegistry::remove(const std::set<std::string>& keys)
+{
+  std::lock_guard<std::mutex> lock(updateMutex);
+  const auto* current = snapshot.load(std::memory_order_relaxed);
+
+  Snapshot next {current->version + 1, current->resources};
+  for (const auto& key: keys) {
+    next.resources.erase(key);
+  }
+
+  snapshots.push_back(std::move(next));
+  snapshot.store(&snapshots.back(), std::memory_order_release);
+}
+
+void ResourceRegistry::clear()
+{
+  std::lock_guard<std::mutex> lock(updateMutex);
+  auto version = snapshot.load(std::memory_order_relaxed)->version;
+  snapshots.clear();
+  snapshots.push_back({version + 1, {}});
+  snapshot.store(&snapshots.back(), std::memory_order_release);
+}
+
+bool ResourceRegistry::contains(std::string_view key) const
+{
+  const auto& resources = snapshot.load(std::memory_order_acquire)->resources;
+  return resources.find(key) != resources.end();
+}
+
+uint64_t ResourceRegistry::getVersion() const
+{
+  return snapshot.load(std::memory_order_acquire)->version;
+}
+
+const Resource& ResourceRegistry::find(std::string_view key) const
+{
+  const auto& resources = snapshot.load(std::memory_order_acquire)->resources;
+  auto it = resources.find(key);
+  if (it == resources.end()) {
+    throw NoSuchResourceException("Resource not found in the registry: "
+                                  + std::string(key));
+  }
+  return it->second;
+}
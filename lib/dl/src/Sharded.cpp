@@ -0,0 +1,43 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/Sharded.h"
+
+#include <functional>
+#include <thread>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace {
+
+size_t getThreadHash()
+{
+  thread_local const size_t hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  return hash;
+}
+
+} // namespace
+
+size_t cppps::getDefaultShardCount()
+{
+  auto cpus = std::thread::hardware_concurrency();
+  return cpus > 0 ? cpus : 1;
+}
+
+size_t cppps::getShardHint(ShardSelection selection)
+{
+#ifdef __linux__
+  if (selection == ShardSelection::CPU) {
+    auto cpu = sched_getcpu();
+    if (cpu >= 0) {
+      return static_cast<size_t>(cpu);
+    }
+  }
+#else
+  (void)selection;
+#endif
+  return getThreadHash();
+}
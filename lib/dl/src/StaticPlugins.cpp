@@ -0,0 +1,56 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/StaticPlugins.h"
+
+#include <mutex>
+
+#ifdef CPPPS_STATIC_PLUGINS_IN_SECTION
+// defined by the linker if any object of the program has the section
+extern "C" {
+extern const cppps::StaticPluginEntry __start_cppps_plugins[] __attribute__((weak));
+extern const cppps::StaticPluginEntry __stop_cppps_plugins[] __attribute__((weak));
+}
+#endif
+
+namespace {
+
+struct Registry
+{
+  std::mutex mutex;
+  cppps::StaticPluginEntries entries;
+};
+
+Registry& getRegistry()
+{
+  // constructed on the first use, the registering objects
+  // may be initialized before this translation unit
+  static Registry registry;
+  return registry;
+}
+
+} // namespace
+
+bool cppps::registerStaticPlugin(const StaticPluginEntry& entry)
+{
+  auto& registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.entries.push_back(entry);
+  return true;
+}
+
+cppps::StaticPluginEntries cppps::getStaticPlugins()
+{
+  StaticPluginEntries plugins;
+#ifdef CPPPS_STATIC_PLUGINS_IN_SECTION
+  if (__start_cppps_plugins != nullptr) {
+    plugins.assign(__start_cppps_plugins, __stop_cppps_plugins);
+  }
+#endif
+
+  auto& registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  plugins.insert(plugins.end(), registry.entries.begin(), registry.entries.end());
+  return plugins;
+}
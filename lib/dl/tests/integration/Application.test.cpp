@@ -4,11 +4,22 @@
 
 #include "cppps/dl/Application.h"
 #include "cppps/dl/Cli.h"
+#include "cppps/dl/IReactor.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
 #include <iostream>
+#include <thread>
 #include <filesystem>
 #include <catch2/catch.hpp>
 
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 #include "test_plugins/ITestProduct.h"
 
 using namespace cppps;
@@ -90,6 +101,163 @@ public:
 };
 
 
+class SpyPluginWithReactor: public SpyPlugin
+{
+public:
+  using SpyPlugin::SpyPlugin;
+  void prepare(const ICliPtr& cli, IApplication& app) override
+  {
+    SpyPlugin::prepare(cli, app);
+    this->app = &app;
+  }
+
+  void start() override
+  {
+    SpyPlugin::start();
+    app->getReactor().addTimer(std::chrono::milliseconds(1), [this](){
+      ++timerCalls;
+      app->quit();
+    });
+  }
+
+  IApplication* app {nullptr};
+  int timerCalls {0};
+};
+
+
+class SpyPluginWithNamedLoops: public SpyPlugin
+{
+public:
+  using SpyPlugin::SpyPlugin;
+  void prepare(const ICliPtr& cli, IApplication& app) override
+  {
+    SpyPlugin::prepare(cli, app);
+    this->app = &app;
+    app.addMainLoop("finishing_loop", [](){return 0;});
+    app.addMainLoop("waiting_loop", [this](){
+      while (!stopped) {
+        std::this_thread::yield();
+      }
+      return LOOP_EXIT_CODE;
+    });
+  }
+
+  void start() override
+  {
+    SpyPlugin::start();
+    // the reactor runs on the main thread while the loops are running
+    app->getReactor().post([this](){app->quit();});
+  }
+
+  void stop() override
+  {
+    SpyPlugin::stop();
+    stopped = true;
+  }
+
+  static constexpr int LOOP_EXIT_CODE = 3;
+  IApplication* app {nullptr};
+  std::atomic_bool stopped {false};
+};
+
+
+class SpyPluginWithSlowStop: public SpyPlugin
+{
+public:
+  using SpyPlugin::SpyPlugin;
+  void prepare(const ICliPtr& cli, IApplication& app) override
+  {
+    SpyPlugin::prepare(cli, app);
+    this->app = &app;
+    app.setStopDeadline(getName(), STOP_DEADLINE);
+  }
+
+  void start() override
+  {
+    SpyPlugin::start();
+    // keeps the reactor running until the signal is handled
+    app->getReactor().addTimer(std::chrono::seconds(10), [](){});
+    app->getReactor().addTimer(std::chrono::milliseconds(1), [](){std::raise(SIGINT);});
+  }
+
+  void stop() override
+  {
+    std::this_thread::sleep_for(STOP_DURATION);
+    SpyPlugin::stop();
+  }
+
+  static constexpr auto STOP_DEADLINE = std::chrono::milliseconds(5);
+  static constexpr auto STOP_DURATION = std::chrono::milliseconds(50);
+  IApplication* app {nullptr};
+};
+
+
+class SpyPluginInterruptedInPrepare: public SpyPluginWithLoop
+{
+public:
+  using SpyPluginWithLoop::SpyPluginWithLoop;
+  void prepare(const ICliPtr& cli, IApplication& app) override
+  {
+    SpyPluginWithLoop::prepare(cli, app);
+    std::raise(SIGINT);
+    // the signal thread quits the application meanwhile
+    std::this_thread::sleep_for(SIGNAL_HANDLING_TIME);
+  }
+
+  static constexpr auto SIGNAL_HANDLING_TIME = std::chrono::milliseconds(100);
+};
+
+
+class SpyPluginWithTask: public SpyPlugin
+{
+public:
+  SpyPluginWithTask(Values& values, IReactor::Callback task)
+    : SpyPlugin(values), task{std::move(task)} {}
+
+  std::string getName() const override {return "spy_plugin_with_task";}
+
+  void prepare(const ICliPtr& cli, IApplication& app) override
+  {
+    SpyPlugin::prepare(cli, app);
+    this->app = &app;
+  }
+
+  void start() override
+  {
+    SpyPlugin::start();
+    app->getReactor().post(task);
+  }
+
+  IApplication* app {nullptr};
+  IReactor::Callback task;
+};
+
+
+class SpyPluginWithExitFlush: public SpyPlugin
+{
+public:
+  SpyPluginWithExitFlush(Values& values, int flushFd)
+    : SpyPlugin(values), values{values}, flushFd{flushFd} {}
+
+  void prepare(const ICliPtr& cli, IApplication& app) override
+  {
+    SpyPlugin::prepare(cli, app);
+    app.setMainLoop([](){return EXIT_CODE;});
+    app.addOnExitFlushHook([this](){
+      // report the state the plugin is left in
+      auto state = static_cast<char>(values.state);
+      [[maybe_unused]] auto result = write(flushFd, &state, sizeof(state));
+    });
+  }
+
+  static constexpr int EXIT_CODE = 5;
+
+private:
+  Values& values;
+  int flushFd;
+};
+
+
 } // namespace
 } // namespace test
 
@@ -125,6 +293,84 @@ TEST_CASE("Testing application execution", "[app_exec]")
   }
 
 
+  SECTION("When no main loop is set and the reactor has sources, then the reactor runs until quit")
+  {
+    test::SpyPlugin::Values values;
+    auto plugin = std::make_unique<test::SpyPluginWithReactor>(values);
+    auto& timerCalls = plugin->timerCalls;
+    app.preloadPlugin(std::move(plugin));
+    app.exec();
+
+    REQUIRE(timerCalls == 1);
+    REQUIRE(values.state == test::SpyPlugin::State::STOPPED);
+  }
+
+
+  SECTION("When named loops are added, then they run on their own threads until the plugins are stopped")
+  {
+    test::SpyPlugin::Values values;
+    app.preloadPlugin(std::make_unique<test::SpyPluginWithNamedLoops>(values));
+    auto result = app.exec();
+
+    REQUIRE(result == test::SpyPluginWithNamedLoops::LOOP_EXIT_CODE);
+    REQUIRE(app.getLoopExitCodes() == Application::LoopExitCodes{
+      {"finishing_loop", 0}, {"waiting_loop", test::SpyPluginWithNamedLoops::LOOP_EXIT_CODE}});
+  }
+
+
+#ifndef _WIN32
+  SECTION("When a plugin is added to the running application, then it gets the resources of the running plugins")
+  {
+    test::SpyPlugin::Values values;
+    test::SpyPlugin::Values addedValues;
+    app.preloadPlugin(std::make_unique<test::SpyPluginWithTask>(values, [&](){
+      app.addPlugin(std::make_unique<test::SpyPlugin>(addedValues));
+      app.quit();
+    }));
+    app.exec();
+
+    REQUIRE(addedValues.product != nullptr);
+    REQUIRE(addedValues.product == values.product);
+    REQUIRE(addedValues.state == test::SpyPlugin::State::STOPPED);
+  }
+
+  SECTION("When a plugin is added before the start, then an exception is thrown")
+  {
+    test::SpyPlugin::Values values;
+    REQUIRE_THROWS(app.addPlugin(std::make_unique<test::SpyPlugin>(values)));
+  }
+
+
+  SECTION("When the application is interrupted, then the plugins are stopped and the exceeded deadlines are reported")
+  {
+    test::SpyPlugin::Values values;
+    app.preloadPlugin(std::make_unique<test::SpyPluginWithSlowStop>(values));
+    app.exec();
+
+    REQUIRE(values.state == test::SpyPlugin::State::STOPPED);
+    const auto& report = app.getStopReport();
+    auto entry = std::find_if(report.begin(), report.end(), [](const auto& entry){
+      return entry.pluginName == "spy_plugin";
+    });
+    REQUIRE(entry != report.end());
+    REQUIRE(entry->deadline == test::SpyPluginWithSlowStop::STOP_DEADLINE);
+    REQUIRE(entry->deadlineExceeded);
+  }
+
+  SECTION("When the application is interrupted during the boot, then the plugins are not started")
+  {
+    test::SpyPlugin::Values values;
+    auto plugin = std::make_unique<test::SpyPluginInterruptedInPrepare>(values);
+    auto& pluginRef = *plugin;
+    app.preloadPlugin(std::move(plugin));
+    app.exec();
+
+    REQUIRE(values.state == test::SpyPlugin::State::PREPARED);
+    REQUIRE(pluginRef.mainLoopExecutions == 0);
+  }
+#endif
+
+
   SECTION("When the application main loop is set twice, then an exception is thrown")
   {
     test::SpyPlugin::Values values;
@@ -216,3 +462,40 @@ TEST_CASE("Testing application destruction", "[app_destruct]")
     REQUIRE(values.state == test::SpyPlugin::State::UNLOADED);
   }
 }
+
+#ifndef _WIN32
+TEST_CASE("Testing application fast exit", "[app_fast_exit]")
+{
+  SECTION("When the fast exit is enabled, then the plugins are stopped, "
+          "the sinks are flushed and the process exits without unloading the plugins")
+  {
+    int flushPipe[2];
+    REQUIRE(pipe(flushPipe) == 0);
+
+    auto pid = fork();
+    REQUIRE(pid >= 0);
+    if (pid == 0) {
+      auto info = test::info;
+      info.interruptable = false;
+      info.fastExit = true;
+
+      test::SpyPlugin::Values values;
+      Application app(info);
+      app.preloadPlugin(std::make_unique<test::SpyPluginWithExitFlush>(values, flushPipe[1]));
+      app.exec();
+      _exit(EXIT_FAILURE); // not reached
+    }
+
+    close(flushPipe[1]);
+    int status = 0;
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == test::SpyPluginWithExitFlush::EXIT_CODE);
+
+    char state = 0;
+    REQUIRE(read(flushPipe[0], &state, sizeof(state)) == sizeof(state));
+    REQUIRE(state == static_cast<char>(test::SpyPlugin::State::STOPPED));
+    close(flushPipe[0]);
+  }
+}
+#endif
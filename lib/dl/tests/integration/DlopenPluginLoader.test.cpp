@@ -4,12 +4,15 @@
 
 
 #include "cppps/dl/exceptions.h"
+#include "cppps/dl/PluginBundle.h"
+#include "cppps/dl/PluginDescriptor.h"
 #include "DlopenPluginLoader.h"
 #include "OsUtils.h"
 
 #include <catch2/catch.hpp>
 
 #include <filesystem>
+#include <set>
 
 using cppps::DlopenPluginLoader;
 using cppps::PluginDeleter;
@@ -19,6 +22,11 @@ namespace {
 
 constexpr const char* getPluginExtension();
 
+using Keys = std::set<std::string>;
+
+Keys getProvidedKeys(cppps::IPlugin& plugin);
+Keys getConsumedKeys(cppps::IPlugin& plugin);
+
 const auto PLUGIN_DIR = cppps::getProgramDirPath() + "/test_plugins";
 const auto PLUGIN_BAD_DIR = cppps::getProgramDirPath() + "/test_plugins_bad";
 
@@ -28,6 +36,7 @@ constexpr auto PLUGIN_B_NAME ="plugin_b";
 const auto PLUGIN_B_PATH = PLUGIN_DIR + "/libplugin_b." + getPluginExtension();
 const auto NON_EXISTENT_PLUGIN_PATH = PLUGIN_DIR + "/libplugin_x." + getPluginExtension();
 const auto BAD_PLUGIN_PATH = PLUGIN_BAD_DIR + "/libplugin_bad." + getPluginExtension();
+const auto PLUGIN_BUNDLE_PATH = (std::filesystem::temp_directory_path() / "cppps_test_plugins.bundle").string();
 
 } // namespace
 } // namespace test
@@ -73,7 +82,66 @@ TEST_CASE("Testing plugin loader successful library import", "[pl_success]")
     REQUIRE(plugin2->getName() == test::PLUGIN_B_NAME);
   }
 
+  SECTION("When the plugins are loaded from a bundle, then interface methods can be invoked")
+  {
+    cppps::PluginBundle::write(test::PLUGIN_BUNDLE_PATH, {test::PLUGIN_A_PATH, test::PLUGIN_B_PATH});
+    auto plugin1 = loader.load(cppps::makeBundleEntryPath(test::PLUGIN_BUNDLE_PATH,
+                                                          "libplugin_a.so"));
+    auto plugin2 = loader.load(cppps::makeBundleEntryPath(test::PLUGIN_BUNDLE_PATH,
+                                                          "libplugin_b.so"));
+    std::filesystem::remove(test::PLUGIN_BUNDLE_PATH);
+
+    REQUIRE(plugin1->getName() == test::PLUGIN_A_NAME);
+    REQUIRE(plugin2->getName() == test::PLUGIN_B_NAME);
+  }
+
+  SECTION("When bundled plugins are loaded one after another, then each one gets its own library")
+  {
+    cppps::PluginBundle::write(test::PLUGIN_BUNDLE_PATH, {test::PLUGIN_A_PATH, test::PLUGIN_B_PATH});
+    auto pathA = cppps::makeBundleEntryPath(test::PLUGIN_BUNDLE_PATH, "libplugin_a.so");
+    auto pathB = cppps::makeBundleEntryPath(test::PLUGIN_BUNDLE_PATH, "libplugin_b.so");
+
+    auto plugin1 = loader.load(pathA);
+    auto plugin2 = loader.load(pathB);
+    auto plugin3 = loader.load(pathA);
+    REQUIRE(plugin1->getName() == test::PLUGIN_A_NAME);
+    REQUIRE(plugin2->getName() == test::PLUGIN_B_NAME);
+    REQUIRE(plugin3->getName() == test::PLUGIN_A_NAME);
+
+    plugin1.reset();
+    plugin3.reset();
+    auto plugin4 = loader.load(pathB);
+    auto plugin5 = loader.load(pathA);
+    std::filesystem::remove(test::PLUGIN_BUNDLE_PATH);
+
+    REQUIRE(plugin4->getName() == test::PLUGIN_B_NAME);
+    REQUIRE(plugin5->getName() == test::PLUGIN_A_NAME);
+  }
+
+}
+
+#ifdef CPPPS_PLUGIN_DESCRIPTOR_IN_SECTION
+TEST_CASE("Testing plugin descriptors", "[pl_descriptors]")
+{
+  DlopenPluginLoader loader;
+
+  SECTION("When a plugin is built with the descriptor, then it lists the keys the plugin submits")
+  {
+    for (const auto& path: {test::PLUGIN_A_PATH, test::PLUGIN_B_PATH}) {
+      auto infos = cppps::readPluginDescriptors(path);
+      REQUIRE(infos.size() == 1);
+      const auto& info = infos.front();
+      auto plugin = loader.load(path);
+
+      REQUIRE(info.name == plugin->getName());
+      REQUIRE(test::Keys(info.providedKeys.begin(), info.providedKeys.end())
+              == test::getProvidedKeys(*plugin));
+      REQUIRE(test::Keys(info.consumedKeys.begin(), info.consumedKeys.end())
+              == test::getConsumedKeys(*plugin));
+    }
+  }
 }
+#endif
 
 TEST_CASE("Testing plugin loader exceptions", "[pl_exceptions]")
 {
@@ -89,6 +157,14 @@ TEST_CASE("Testing plugin loader exceptions", "[pl_exceptions]")
     REQUIRE_THROWS_AS(loader.load(test::BAD_PLUGIN_PATH),
                       cppps::MakePluginNotFoundException);
   }
+
+  SECTION("When the bundle has no such plugin image, then the PluginNotFoundException is thrown")
+  {
+    cppps::PluginBundle::write(test::PLUGIN_BUNDLE_PATH, {test::PLUGIN_A_PATH});
+    auto path = cppps::makeBundleEntryPath(test::PLUGIN_BUNDLE_PATH, "libplugin_x.so");
+    REQUIRE_THROWS_AS(loader.load(path), cppps::PluginNotFoundException);
+    std::filesystem::remove(test::PLUGIN_BUNDLE_PATH);
+  }
 }
 
 namespace test {
@@ -103,6 +179,24 @@ constexpr const char* getPluginExtension()
 #endif
 }
 
+Keys getProvidedKeys(cppps::IPlugin& plugin)
+{
+  Keys keys;
+  plugin.submitProviders([&keys](std::string_view key, const cppps::ResourceProvider&){
+    keys.emplace(key);
+  });
+  return keys;
+}
+
+Keys getConsumedKeys(cppps::IPlugin& plugin)
+{
+  Keys keys;
+  plugin.submitConsumers([&keys](std::string_view key, const cppps::ResourceConsumer&){
+    keys.emplace(key);
+  });
+  return keys;
+}
+
 } // namespace
 } // namespace test
 
@@ -6,6 +6,10 @@
 #include "cppps/dl/PluginCollector.h"
 #include "cppps/dl/IPlugin.h"
 #include "cppps/dl/exceptions.h"
+#ifndef _WIN32
+#include "cppps/dl/PluginBundle.h"
+#include "cppps/dl/PluginDescriptor.h"
+#endif
 
 #define CATCH_CONFIG_EXTERNAL_INTERFACES
 #include <catch2/catch.hpp>
@@ -20,6 +24,11 @@
 using cppps::PluginCollector;
 using Path = std::filesystem::path;
 
+#ifdef CPPPS_PLUGIN_DESCRIPTOR_IN_SECTION
+// the test executable copied as a plugin file carries this descriptor
+CPPPS_PLUGIN_DESCRIPTOR("described_plugin", "1.0.0", "", "")
+#endif
+
 namespace test {
 namespace {
 
@@ -46,6 +55,13 @@ const Path PLUGIN_C_2_FILE          = PLUGIN_DIR_C + "/libplugin_c2.so";
 
 const Path PLUGIN_D_1_FILE          = PLUGIN_DIR_D + "/libplugin_d1.so.1.2.3";
 
+const auto PLUGIN_DIR_E = TMP_DIR + "/cppps_test_plugins_5";
+const Path PLUGIN_E_1_FILE          = PLUGIN_DIR_E + "/libplugin_e1.so";
+const auto SELF_PATH = "/proc/self/exe";
+const auto DESCRIBED_PLUGIN_NAME = "described_plugin";
+
+const auto PLUGIN_BUNDLE            = TMP_DIR + "/plugins.bundle";
+
 constexpr auto PLUGIN_DIR_A_COUNT = 2;
 constexpr auto PLUGIN_DIR_B_COUNT = 2;
 constexpr auto PLUGIN_DIR_C_COUNT = 2;
@@ -55,6 +71,7 @@ const auto EXTRA_FILE_ENV_NAME = "PS_TEST_PLUGIN";
 const auto EXTRA_PATH_ENV_NAME = "PS_TEST_PLUGIN_PATH";
 
 void createTestFiles();
+void createDescribedPluginFile();
 void setEnvVariable(const std::string& var, const std::string& value);
 
 
@@ -143,6 +160,74 @@ TEST_CASE("Testing plugin collector", "[plugin_collector]")
     REQUIRE(it == files.end());
   }
 
+  SECTION("When a filter was set, then only the plugins with the accepted names are collected")
+  {
+    collector.addDirectories({test::PLUGIN_DIR_A, test::PLUGIN_DIR_C});
+    collector.setFilter([](const std::string& pluginName){
+      return pluginName == "plugin_a1" || pluginName == "plugin_c2";
+    });
+    auto files = collector.collectPlugins();
+    files.sort();
+
+    auto it = files.begin();
+    REQUIRE(files.size() == 2);
+    REQUIRE(*it == test::PLUGIN_A_1_FILE_VVV_NEW); std::advance(it, 1);
+    REQUIRE(*it == test::PLUGIN_C_2_FILE); std::advance(it, 1);
+    REQUIRE(it == files.end());
+  }
+
+#ifndef _WIN32
+  SECTION("When a bundle was added, then its plugins are collected with the directories")
+  {
+    cppps::PluginBundle::write(test::PLUGIN_BUNDLE, {test::PLUGIN_B_1_FILE.string(),
+                                                     test::PLUGIN_D_1_FILE.string()});
+    collector.addDirectory(test::PLUGIN_DIR_C);
+    collector.addBundle(test::PLUGIN_BUNDLE);
+    collector.setFilter([](const std::string& pluginName){
+      return pluginName != "plugin_c2";
+    });
+    auto files = collector.collectPlugins();
+    files.sort();
+
+    auto it = files.begin();
+    REQUIRE(files.size() == 3);
+    REQUIRE(*it == test::PLUGIN_C_1_FILE); std::advance(it, 1);
+    REQUIRE(*it == cppps::makeBundleEntryPath(test::PLUGIN_BUNDLE, "libplugin_b1.so")); std::advance(it, 1);
+    REQUIRE(*it == cppps::makeBundleEntryPath(test::PLUGIN_BUNDLE, "libplugin_d1.so.1.2.3")); std::advance(it, 1);
+    REQUIRE(it == files.end());
+  }
+#endif
+
+#ifdef CPPPS_PLUGIN_DESCRIPTOR_IN_SECTION
+  SECTION("When a plugin file has the descriptor, then the filter gets the descriptor name")
+  {
+    test::createDescribedPluginFile();
+    collector.addDirectories({test::PLUGIN_DIR_C, test::PLUGIN_DIR_E});
+    collector.setFilter([](const std::string& pluginName){
+      return pluginName == test::DESCRIBED_PLUGIN_NAME;
+    });
+    auto files = collector.collectPlugins();
+
+    REQUIRE(files.size() == 1);
+    REQUIRE(files.front() == test::PLUGIN_E_1_FILE);
+  }
+
+  SECTION("When a bundled plugin has the descriptor, then the filter gets the descriptor name")
+  {
+    test::createDescribedPluginFile();
+    cppps::PluginBundle::write(test::PLUGIN_BUNDLE, {test::PLUGIN_E_1_FILE.string(),
+                                                     test::PLUGIN_B_1_FILE.string()});
+    collector.addBundle(test::PLUGIN_BUNDLE);
+    collector.setFilter([](const std::string& pluginName){
+      return pluginName == test::DESCRIBED_PLUGIN_NAME;
+    });
+    auto files = collector.collectPlugins();
+
+    REQUIRE(files.size() == 1);
+    REQUIRE(files.front() == cppps::makeBundleEntryPath(test::PLUGIN_BUNDLE, "libplugin_e1.so"));
+  }
+#endif
+
   SECTION("When extra directory environment variable is empty, then no exception is thrown")
   {
     collector.enablePathEnvVariable(test::EXTRA_PATH_ENV_NAME);
@@ -273,6 +358,13 @@ void setEnvVariable(const std::string& var, const std::string& value)
 #endif
 }
 
+void createDescribedPluginFile()
+{
+  std::filesystem::create_directories(PLUGIN_DIR_E);
+  std::filesystem::copy_file(SELF_PATH, PLUGIN_E_1_FILE,
+                             std::filesystem::copy_options::overwrite_existing);
+}
+
 void createTestFiles()
 {
   std::filesystem::create_directories(PLUGIN_DIR_A);
@@ -5,6 +5,9 @@
 #include "cppps/dl/Digraph.h"
 #include <catch2/catch.hpp>
 
+#include <random>
+#include <vector>
+
 using cppps::Digraph;
 using cppps::DuplicatedNodeException;
 using cppps::NoSuchNodeException;
@@ -52,6 +55,13 @@ const Data NODE_K {"k", 35};
 
 const Data NODE_X {"x", 100};
 
+constexpr size_t RANDOM_NODE_COUNT = 50;
+constexpr size_t RANDOM_EDGE_COUNT = 500;
+constexpr unsigned RANDOM_SEED = 2026;
+constexpr size_t LARGE_GRAPH_SIZE = Digraph<std::string, Data>::CLOSURE_NODE_LIMIT + 1;
+
+using Keys = Digraph<std::string, Data>::Keys;
+
 } // namespace
 } // namespace test
 
@@ -284,6 +294,219 @@ TEST_CASE("Testing graph topological sorting", "[graph_ts]")
 
 }
 
+TEST_CASE("Testing incremental graph ordering", "[graph_inc]")
+{
+  auto keyGetter = [](const test::Data& user){return user.getId();};
+  Digraph<std::string, test::Data> graph(keyGetter);
+
+  graph.addNode(test::NODE_A);
+  graph.addNode(test::NODE_B);
+  graph.addNode(test::NODE_C);
+  graph.addNode(test::NODE_D);
+
+  SECTION("When an edge breaks the current order, "
+          "then the affected nodes are reordered")
+  {
+    graph.addEdge(test::NODE_A, test::NODE_B);
+    graph.addEdge(test::NODE_B, test::NODE_C);
+    graph.addEdge(test::NODE_C, test::NODE_D);
+
+    auto sorted = graph.topologicalSort();
+    REQUIRE(sorted == std::list<test::Data>{test::NODE_D, test::NODE_C, test::NODE_B, test::NODE_A});
+    REQUIRE(graph.isAcyclic());
+  }
+
+  SECTION("When an acyclic edge closing a cycle is added, "
+          "then it is rejected and the graph is not changed")
+  {
+    REQUIRE(graph.addAcyclicEdge("a", "b"));
+    REQUIRE(graph.addAcyclicEdge("b", "c"));
+    REQUIRE_FALSE(graph.addAcyclicEdge("c", "a"));
+    REQUIRE_FALSE(graph.addAcyclicEdge("d", "d"));
+
+    REQUIRE(graph.isAcyclic());
+    REQUIRE(graph.findCycles().empty());
+  }
+
+  SECTION("When an edge closing a cycle is added, "
+          "then the graph is cyclic until an edge of the cycle is removed")
+  {
+    graph.addEdge(test::NODE_A, test::NODE_B);
+    graph.addEdge(test::NODE_B, test::NODE_C);
+    graph.addEdge(test::NODE_C, test::NODE_A);
+    REQUIRE_FALSE(graph.isAcyclic());
+    REQUIRE_FALSE(graph.addAcyclicEdge("a", "c"));
+
+    REQUIRE(graph.removeEdge(test::NODE_C, test::NODE_A));
+    REQUIRE_FALSE(graph.removeEdge(test::NODE_C, test::NODE_A));
+    REQUIRE(graph.isAcyclic());
+
+    auto indexMap = test::getIndices(graph.topologicalSort());
+    REQUIRE(indexMap[test::NODE_B] < indexMap[test::NODE_A]);
+    REQUIRE(indexMap[test::NODE_C] < indexMap[test::NODE_B]);
+  }
+
+  SECTION("When a node is removed, "
+          "then its edges are removed and the other nodes keep their edges")
+  {
+    graph.addEdge(test::NODE_A, test::NODE_B);
+    graph.addEdge(test::NODE_B, test::NODE_D);
+    graph.addEdge(test::NODE_C, test::NODE_D);
+
+    graph.removeNode("b");
+
+    REQUIRE(graph.size() == 3);
+    REQUIRE_THROWS_AS(graph.getNode("b"), NoSuchNodeException);
+    REQUIRE(graph.getNode("d") == test::NODE_D);
+    REQUIRE_FALSE(graph.removeEdge(test::NODE_A, test::NODE_D));
+
+    auto indexMap = test::getIndices(graph.topologicalSort());
+    REQUIRE(indexMap.size() == 3);
+    REQUIRE(indexMap[test::NODE_D] < indexMap[test::NODE_C]);
+    REQUIRE(graph.removeEdge(test::NODE_C, test::NODE_D));
+  }
+
+  SECTION("When a node of a cycle is removed, "
+          "then the graph becomes acyclic")
+  {
+    graph.addEdge(test::NODE_A, test::NODE_B);
+    graph.addEdge(test::NODE_B, test::NODE_A);
+    REQUIRE_FALSE(graph.isAcyclic());
+
+    graph.removeNode("a");
+    REQUIRE(graph.isAcyclic());
+    REQUIRE(graph.topologicalSort().size() == 3);
+  }
+
+  SECTION("When random edges are added, "
+          "then exactly the edges closing cycles are rejected and the order is kept")
+  {
+    Digraph<std::string, test::Data> randomGraph(keyGetter);
+    std::vector<std::vector<bool>> reachable(test::RANDOM_NODE_COUNT,
+                                             std::vector<bool>(test::RANDOM_NODE_COUNT, false));
+    for (size_t i = 0; i < test::RANDOM_NODE_COUNT; ++i) {
+      randomGraph.addNode({std::to_string(i), static_cast<int>(i)});
+      reachable[i][i] = true;
+    }
+
+    std::mt19937 generator(test::RANDOM_SEED);
+    std::uniform_int_distribution<size_t> distribution(0, test::RANDOM_NODE_COUNT - 1);
+    std::vector<std::pair<size_t, size_t>> edges;
+    for (size_t i = 0; i < test::RANDOM_EDGE_COUNT; ++i) {
+      auto start = distribution(generator);
+      auto end = distribution(generator);
+      bool closesCycle = reachable[end][start];
+
+      REQUIRE(randomGraph.addAcyclicEdge(std::to_string(start), std::to_string(end)) != closesCycle);
+      if (!closesCycle) {
+        edges.emplace_back(start, end);
+        for (size_t from = 0; from < test::RANDOM_NODE_COUNT; ++from) {
+          if (reachable[from][start]) {
+            for (size_t to = 0; to < test::RANDOM_NODE_COUNT; ++to) {
+              reachable[from][to] = reachable[from][to] || reachable[end][to];
+            }
+          }
+        }
+      }
+    }
+
+    auto indexMap = test::getIndices(randomGraph.topologicalSort());
+    for (const auto& [start, end]: edges) {
+      REQUIRE(indexMap[{std::to_string(end), 0}] < indexMap[{std::to_string(start), 0}]);
+    }
+  }
+}
+
+TEST_CASE("Testing graph reachability queries", "[graph_reach]")
+{
+  auto keyGetter = [](const test::Data& user){return user.getId();};
+  Digraph<std::string, test::Data> graph(keyGetter);
+
+  // a -> b -> d, a -> c -> d, e
+  graph.addNode(test::NODE_A);
+  graph.addNode(test::NODE_B);
+  graph.addNode(test::NODE_C);
+  graph.addNode(test::NODE_D);
+  graph.addNode(test::NODE_E);
+  graph.addEdge(test::NODE_A, test::NODE_B);
+  graph.addEdge(test::NODE_A, test::NODE_C);
+  graph.addEdge(test::NODE_B, test::NODE_D);
+  graph.addEdge(test::NODE_C, test::NODE_D);
+
+  SECTION("When the direct neighbours are requested, "
+          "then the heads and the tails of the node edges are returned")
+  {
+    REQUIRE(graph.getSuccessors("a") == test::Keys{"b", "c"});
+    REQUIRE(graph.getPredecessors("d") == test::Keys{"b", "c"});
+    REQUIRE(graph.getPredecessors("a").empty());
+  }
+
+  SECTION("When the descendants and ancestors are requested, "
+          "then the transitively connected nodes are returned in the topological order")
+  {
+    auto descendants = graph.getDescendants("a");
+    REQUIRE(descendants.size() == 3);
+    REQUIRE(descendants.front() == "d");
+
+    auto ancestors = graph.getAncestors("d");
+    REQUIRE(ancestors.size() == 3);
+    REQUIRE(ancestors.back() == "a");
+
+    REQUIRE(graph.getDescendants("e").empty());
+    REQUIRE(graph.getAncestors("e").empty());
+  }
+
+  SECTION("When the reachability is checked, "
+          "then only the paths following the edge directions are found")
+  {
+    REQUIRE(graph.isReachable("a", "d"));
+    REQUIRE_FALSE(graph.isReachable("d", "a"));
+    REQUIRE_FALSE(graph.isReachable("b", "c"));
+    REQUIRE_FALSE(graph.isReachable("a", "a"));
+    REQUIRE_THROWS_AS(graph.isReachable("a", "x"), NoSuchNodeException);
+  }
+
+  SECTION("When the graph is changed after a query, "
+          "then the next query reflects the change")
+  {
+    REQUIRE_FALSE(graph.isReachable("d", "e"));
+    graph.addEdge(test::NODE_D, test::NODE_E);
+    REQUIRE(graph.isReachable("a", "e"));
+
+    graph.removeNode("d");
+    REQUIRE_FALSE(graph.isReachable("a", "e"));
+    REQUIRE(graph.getAncestors("e").empty());
+  }
+
+  SECTION("When the graph has a cycle, "
+          "then the nodes of the cycle reach themselves")
+  {
+    graph.addEdge(test::NODE_D, test::NODE_A);
+
+    REQUIRE(graph.isReachable("a", "a"));
+    REQUIRE(graph.isReachable("d", "c"));
+    REQUIRE(graph.getDescendants("b").size() == 4);
+    REQUIRE(graph.getAncestors("e").empty());
+  }
+
+  SECTION("When the graph exceeds the closure limit, "
+          "then the queries give the same answers")
+  {
+    Digraph<std::string, test::Data> chain(keyGetter);
+    for (size_t i = 0; i < test::LARGE_GRAPH_SIZE; ++i) {
+      chain.addNode({std::to_string(i), static_cast<int>(i)});
+      if (i > 0) {
+        chain.addEdge(std::to_string(i), std::to_string(i - 1));
+      }
+    }
+
+    REQUIRE(chain.isReachable(std::to_string(test::LARGE_GRAPH_SIZE - 1), "0"));
+    REQUIRE_FALSE(chain.isReachable("0", "1"));
+    REQUIRE(chain.getAncestors("0").size() == test::LARGE_GRAPH_SIZE - 1);
+    REQUIRE(chain.getDescendants("1") == test::Keys{"0"});
+  }
+}
+
 TEST_CASE("Testing finding cycles", "[graph_cycles]")
 {
   auto keyGetter = [](const test::Data& user){return user.getId();};
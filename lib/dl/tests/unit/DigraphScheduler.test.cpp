@@ -0,0 +1,187 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/DigraphScheduler.h"
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using cppps::Digraph;
+using cppps::DigraphScheduler;
+using namespace std::chrono_literals;
+
+namespace test {
+namespace {
+
+struct Job
+{
+  std::string name;
+};
+
+using JobDigraph = Digraph<std::string, Job>;
+using JobScheduler = DigraphScheduler<std::string, Job>;
+
+const Job JOB_A {"a"};
+const Job JOB_B {"b"};
+const Job JOB_C {"c"};
+const Job JOB_D {"d"};
+
+constexpr size_t THREAD_COUNT = 4;
+constexpr auto SHORT_TIMEOUT = 5ms;
+constexpr auto SLOW_JOB_DURATION = 50ms;
+
+class Recorder
+{
+public:
+  void record(const std::string& name)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    positions[name] = positions.size();
+  }
+
+  bool isBefore(const std::string& first, const std::string& second) const
+  {
+    return positions.at(first) < positions.at(second);
+  }
+
+  bool contains(const std::string& name) const {return positions.count(name) > 0;}
+
+  size_t size() const {return positions.size();}
+
+private:
+  std::mutex mutex;
+  std::map<std::string, size_t> positions;
+};
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing graph scheduling", "[graph_sched]")
+{
+  // d depends on b and c, which both depend on a
+  test::JobDigraph graph([](const test::Job& job){return job.name;});
+  graph.addNode(test::JOB_A);
+  graph.addNode(test::JOB_B);
+  graph.addNode(test::JOB_C);
+  graph.addNode(test::JOB_D);
+  graph.addEdge(test::JOB_B, test::JOB_A);
+  graph.addEdge(test::JOB_C, test::JOB_A);
+  graph.addEdge(test::JOB_D, test::JOB_B);
+  graph.addEdge(test::JOB_D, test::JOB_C);
+
+  test::Recorder recorder;
+
+  SECTION("When the nodes are scheduled, "
+          "then every node is processed after the nodes it points to")
+  {
+    test::JobScheduler scheduler(graph);
+    scheduler.setThreadCount(test::THREAD_COUNT);
+    auto skipped = scheduler.run([&recorder](auto& job, bool){recorder.record(job.name);});
+
+    REQUIRE(skipped.empty());
+    REQUIRE(recorder.size() == 4);
+    REQUIRE(recorder.isBefore("a", "b"));
+    REQUIRE(recorder.isBefore("a", "c"));
+    REQUIRE(recorder.isBefore("b", "d"));
+    REQUIRE(recorder.isBefore("c", "d"));
+  }
+
+  SECTION("When the nodes are scheduled in the dependents-first order, "
+          "then every node is processed after the nodes pointing to it")
+  {
+    test::JobScheduler scheduler(graph, test::JobScheduler::Order::DEPENDENTS_FIRST);
+    scheduler.run([&recorder](auto& job, bool){recorder.record(job.name);});
+
+    REQUIRE(recorder.isBefore("d", "b"));
+    REQUIRE(recorder.isBefore("d", "c"));
+    REQUIRE(recorder.isBefore("b", "a"));
+    REQUIRE(recorder.isBefore("c", "a"));
+  }
+
+  SECTION("When independent nodes are ready, "
+          "then they are processed concurrently")
+  {
+    std::atomic<int> running {0};
+    std::atomic<int> maxRunning {0};
+    test::JobScheduler scheduler(graph);
+    scheduler.setThreadCount(test::THREAD_COUNT);
+    scheduler.run([&](auto&, bool){
+      auto count = ++running;
+      auto max = maxRunning.load();
+      while (count > max && !maxRunning.compare_exchange_weak(max, count)) {}
+      std::this_thread::sleep_for(test::SLOW_JOB_DURATION);
+      --running;
+    });
+
+    REQUIRE(maxRunning == 2);
+  }
+
+  SECTION("When an action throws, "
+          "then the exception is rethrown and the dependent nodes are not processed")
+  {
+    test::JobScheduler scheduler(graph);
+    REQUIRE_THROWS_AS(scheduler.run([&recorder](auto& job, bool){
+      if (job.name == "b") {
+        throw std::runtime_error("job failed");
+      }
+      recorder.record(job.name);
+    }), std::runtime_error);
+    REQUIRE_FALSE(recorder.contains("d"));
+  }
+
+  SECTION("When the timeout passes with the skip policy, "
+          "then the remaining nodes are reported as skipped")
+  {
+    test::JobScheduler scheduler(graph);
+    scheduler.setTimeout(test::SHORT_TIMEOUT,
+                         test::JobScheduler::TimeoutPolicy::SKIP);
+    auto skipped = scheduler.run([](auto& job, bool){
+      if (job.name == "a") {
+        std::this_thread::sleep_for(test::SLOW_JOB_DURATION);
+      }
+    });
+
+    REQUIRE(skipped.size() == 3);
+  }
+
+  SECTION("When the timeout passes with the force policy, "
+          "then the remaining nodes are processed at once and marked as forced")
+  {
+    std::mutex forcedMutex;
+    std::vector<std::string> forced;
+    test::JobScheduler scheduler(graph);
+    scheduler.setThreadCount(test::THREAD_COUNT);
+    scheduler.setTimeout(test::SHORT_TIMEOUT,
+                         test::JobScheduler::TimeoutPolicy::FORCE);
+    auto skipped = scheduler.run([&](auto& job, bool isForced){
+      if (job.name == "a") {
+        std::this_thread::sleep_for(test::SLOW_JOB_DURATION);
+      }
+      if (isForced) {
+        std::lock_guard<std::mutex> lock(forcedMutex);
+        forced.push_back(job.name);
+      }
+    });
+
+    REQUIRE(skipped.empty());
+    REQUIRE(forced.size() == 3);
+  }
+
+  SECTION("When the graph has a cycle, "
+          "then the nodes of the cycle are reported as skipped")
+  {
+    graph.addEdge(test::JOB_A, test::JOB_D);
+    test::JobScheduler scheduler(graph);
+    auto skipped = scheduler.run([](auto&, bool){});
+
+    REQUIRE(skipped.size() == 4);
+  }
+}
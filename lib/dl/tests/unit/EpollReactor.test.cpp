@@ -0,0 +1,152 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/EpollReactor.h"
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using cppps::EpollReactor;
+using cppps::IReactor;
+using namespace std::chrono_literals;
+
+namespace test {
+namespace {
+
+constexpr int EXIT_CODE = 7;
+constexpr char MESSAGE = 'x';
+
+struct Pipe
+{
+  Pipe() {REQUIRE(pipe(fds) == 0);}
+  ~Pipe() {close(fds[0]); close(fds[1]);}
+  int fds[2] {-1, -1};
+};
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing epoll reactor", "[reactor]")
+{
+  EpollReactor reactor;
+
+  SECTION("When a reactor is stopped, then run() returns the exit code")
+  {
+    reactor.post([&reactor](){reactor.stop(test::EXIT_CODE);});
+    REQUIRE(reactor.hasSources());
+    REQUIRE(reactor.run() == test::EXIT_CODE);
+  }
+
+  SECTION("When a stopped reactor is run again, then it runs until the next stop")
+  {
+    reactor.stop();
+    REQUIRE(reactor.run() == 0);
+
+    bool executed = false;
+    reactor.post([&](){
+      executed = true;
+      reactor.stop(test::EXIT_CODE);
+    });
+    REQUIRE(reactor.run() == test::EXIT_CODE);
+    REQUIRE(executed);
+  }
+
+  SECTION("When the reactor is stopped by a task, then the tasks posted after it run on the next run")
+  {
+    std::vector<int> executed;
+    reactor.post([&](){reactor.stop(test::EXIT_CODE);});
+    reactor.post([&](){executed.push_back(1);});
+    reactor.post([&](){executed.push_back(2);});
+    REQUIRE(reactor.run() == test::EXIT_CODE);
+    REQUIRE(executed.empty());
+    REQUIRE(reactor.hasSources());
+
+    reactor.post([&](){reactor.stop();});
+    REQUIRE(reactor.run() == 0);
+    REQUIRE(executed == std::vector<int>{1, 2});
+    REQUIRE_FALSE(reactor.hasSources());
+  }
+
+  SECTION("When a descriptor becomes readable, then its callback is called on the reactor thread")
+  {
+    test::Pipe pipe;
+    char received = 0;
+    bool onReactorThread = false;
+    reactor.addFd(pipe.fds[0], IReactor::READABLE, [&](IReactor::Events events){
+      REQUIRE((events & IReactor::READABLE) != 0);
+      REQUIRE(read(pipe.fds[0], &received, 1) == 1);
+      onReactorThread = reactor.isReactorThread();
+      reactor.stop();
+    });
+
+    REQUIRE(write(pipe.fds[1], &test::MESSAGE, 1) == 1);
+    reactor.run();
+
+    REQUIRE(received == test::MESSAGE);
+    REQUIRE(onReactorThread);
+    REQUIRE(reactor.removeFd(pipe.fds[0]));
+    REQUIRE_FALSE(reactor.removeFd(pipe.fds[0]));
+  }
+
+  SECTION("When timers expire, then the callbacks are called in the deadline order")
+  {
+    std::vector<int> fired;
+    auto start = std::chrono::steady_clock::now();
+    reactor.addTimer(20ms, [&](){fired.push_back(2); reactor.stop();});
+    reactor.addTimer(5ms, [&](){fired.push_back(1);});
+    auto cancelled = reactor.addTimer(10ms, [&](){fired.push_back(0);});
+    REQUIRE(reactor.cancelTimer(cancelled));
+
+    reactor.run();
+
+    REQUIRE(fired == std::vector<int>{1, 2});
+    REQUIRE(std::chrono::steady_clock::now() - start >= 20ms);
+  }
+
+  SECTION("When a periodic timer is added, then it fires until cancelled")
+  {
+    int calls = 0;
+    IReactor::TimerId id = 0;
+    id = reactor.addTimer(1ms, [&](){
+      if (++calls == 3) {
+        reactor.cancelTimer(id);
+        reactor.addTimer(10ms, [&](){reactor.stop();});
+      }
+    }, 1ms);
+
+    reactor.run();
+    REQUIRE(calls == 3);
+  }
+
+  SECTION("When a task is posted from another thread, then the reactor wakes up and runs it")
+  {
+    std::atomic<bool> executed {false};
+    std::thread poster([&](){
+      std::this_thread::sleep_for(10ms);
+      reactor.post([&](){
+        executed = reactor.isReactorThread();
+        reactor.stop();
+      });
+    });
+
+    // keeps the reactor waiting
+    reactor.addTimer(1h, [](){});
+    reactor.run();
+    poster.join();
+    REQUIRE(executed);
+  }
+
+  SECTION("When the reactor is cleared, then no sources remain")
+  {
+    test::Pipe pipe;
+    reactor.addFd(pipe.fds[0], IReactor::READABLE, [](IReactor::Events){});
+    reactor.addTimer(1h, [](){});
+    reactor.clear();
+    REQUIRE_FALSE(reactor.hasSources());
+  }
+}
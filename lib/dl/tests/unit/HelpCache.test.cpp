@@ -0,0 +1,95 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "HelpCache.h"
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using cppps::AppInfo;
+using cppps::HelpCache;
+
+namespace test {
+namespace {
+
+const auto TMP_DIR = std::filesystem::temp_directory_path() / "cppps_help_cache_test";
+const auto CACHE_PATH = (TMP_DIR / "cache" / "help.txt").string();
+const auto PLUGIN_PATH = (TMP_DIR / "libplugin_a.so").string();
+constexpr auto HELP_PAGE = "Usage: app [OPTIONS]\n\nOptions:\n  --plugin-option TEXT\n";
+constexpr auto BUILTIN_PLUGIN_NAME = "builtin";
+constexpr auto APP_NAME = "app";
+constexpr auto APP_DESCRIPTION = "Application description";
+constexpr int COLUMN_WIDTH = 60;
+
+void writeFile(const std::string& path, const std::string& content)
+{
+  std::ofstream(path) << content;
+}
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing help cache", "[help_cache]")
+{
+  std::filesystem::remove_all(test::TMP_DIR);
+  std::filesystem::create_directories(test::TMP_DIR);
+  test::writeFile(test::PLUGIN_PATH, "plugin image");
+
+  AppInfo appInfo;
+  appInfo.appName = test::APP_NAME;
+  appInfo.appDescription = test::APP_DESCRIPTION;
+
+  HelpCache cache(test::CACHE_PATH);
+  auto fingerprint = HelpCache::makeFingerprint(appInfo, {test::PLUGIN_PATH}, {test::BUILTIN_PLUGIN_NAME});
+
+  SECTION("When nothing has been cached, then no help page is read")
+  {
+    REQUIRE_FALSE(cache.read(fingerprint).has_value());
+  }
+
+  SECTION("When the help page has been cached, then it is read for the same fingerprint")
+  {
+    cache.update(fingerprint, test::HELP_PAGE);
+    auto help = cache.read(fingerprint);
+
+    REQUIRE(help.has_value());
+    REQUIRE(*help == test::HELP_PAGE);
+  }
+
+  SECTION("When the plugin set changes, then the fingerprint changes")
+  {
+    REQUIRE(fingerprint == HelpCache::makeFingerprint(appInfo, {test::PLUGIN_PATH},
+                                                      {test::BUILTIN_PLUGIN_NAME}));
+    REQUIRE(fingerprint != HelpCache::makeFingerprint(appInfo, {test::PLUGIN_PATH}, {}));
+    REQUIRE(fingerprint != HelpCache::makeFingerprint(appInfo, {}, {test::BUILTIN_PLUGIN_NAME}));
+  }
+
+  SECTION("When the application texts or layout change, then the fingerprint changes")
+  {
+    auto otherAppInfo = appInfo;
+    otherAppInfo.appDescription.clear();
+    REQUIRE(fingerprint != HelpCache::makeFingerprint(otherAppInfo, {test::PLUGIN_PATH},
+                                                      {test::BUILTIN_PLUGIN_NAME}));
+
+    otherAppInfo = appInfo;
+    otherAppInfo.columnWidth = test::COLUMN_WIDTH;
+    REQUIRE(fingerprint != HelpCache::makeFingerprint(otherAppInfo, {test::PLUGIN_PATH},
+                                                      {test::BUILTIN_PLUGIN_NAME}));
+  }
+
+  SECTION("When a plugin file is modified, then the cached help page is stale")
+  {
+    cache.update(fingerprint, test::HELP_PAGE);
+    test::writeFile(test::PLUGIN_PATH, "rebuilt plugin image");
+    auto newFingerprint = HelpCache::makeFingerprint(appInfo, {test::PLUGIN_PATH},
+                                                     {test::BUILTIN_PLUGIN_NAME});
+
+    REQUIRE(newFingerprint != fingerprint);
+    REQUIRE_FALSE(cache.read(newFingerprint).has_value());
+  }
+
+  std::filesystem::remove_all(test::TMP_DIR);
+}
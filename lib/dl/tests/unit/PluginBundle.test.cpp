@@ -0,0 +1,126 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/PluginBundle.h"
+#include "cppps/dl/exceptions.h"
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <unistd.h>
+
+using cppps::PluginBundle;
+
+CPPPS_PLUGIN_DESCRIPTOR("bundled_plugin", "1.2.0", "product", "")
+
+namespace test {
+namespace {
+
+const auto TMP_DIR = std::filesystem::temp_directory_path() / "cppps_plugin_bundle_test";
+const auto BUNDLE_PATH = (TMP_DIR / "plugins.bundle").string();
+const auto PLAIN_PLUGIN_PATH = (TMP_DIR / "libplain.so").string();
+const auto OTHER_PLAIN_PLUGIN_PATH = (TMP_DIR / "other" / "libplain.so").string();
+const std::string SELF_PATH = "/proc/self/exe";
+constexpr auto SELF_IMAGE_NAME = "exe";
+constexpr auto PLAIN_IMAGE_NAME = "libplain.so";
+constexpr auto PLAIN_PLUGIN_CONTENT = "not an ELF file";
+
+std::string readFile(const std::string& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::string& path, const std::string& content)
+{
+  std::ofstream(path, std::ios::binary) << content;
+}
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing plugin bundle", "[plugin_bundle]")
+{
+  std::filesystem::remove_all(test::TMP_DIR);
+  std::filesystem::create_directories(test::TMP_DIR / "other");
+  test::writeFile(test::PLAIN_PLUGIN_PATH, test::PLAIN_PLUGIN_CONTENT);
+  test::writeFile(test::OTHER_PLAIN_PLUGIN_PATH, test::PLAIN_PLUGIN_CONTENT);
+
+  SECTION("When the bundle is written, then its index lists the images in order")
+  {
+    PluginBundle::write(test::BUNDLE_PATH, {test::SELF_PATH, test::PLAIN_PLUGIN_PATH});
+    PluginBundle bundle(test::BUNDLE_PATH);
+
+    REQUIRE(bundle.getEntries().size() == 2);
+    REQUIRE(bundle.getEntries()[0].name == test::SELF_IMAGE_NAME);
+    REQUIRE(bundle.getEntries()[1].name == test::PLAIN_IMAGE_NAME);
+    REQUIRE(bundle.findEntry(test::PLAIN_IMAGE_NAME) == &bundle.getEntries()[1]);
+    REQUIRE(bundle.findEntry("libmissing.so") == nullptr);
+  }
+
+  SECTION("When the bundle is written, then the plugin descriptors are indexed")
+  {
+    PluginBundle::write(test::BUNDLE_PATH, {test::SELF_PATH, test::PLAIN_PLUGIN_PATH});
+    PluginBundle bundle(test::BUNDLE_PATH);
+    const auto& selfEntry = *bundle.findEntry(test::SELF_IMAGE_NAME);
+
+    REQUIRE(selfEntry.info.has_value());
+    REQUIRE(selfEntry.info->name == "bundled_plugin");
+    REQUIRE(selfEntry.info->version == "1.2.0");
+    REQUIRE(selfEntry.info->providedKeys == std::vector<std::string>{"product"});
+    REQUIRE_FALSE(bundle.findEntry(test::PLAIN_IMAGE_NAME)->info.has_value());
+  }
+
+  SECTION("When an image is read, then it is identical to the plugin file")
+  {
+    PluginBundle::write(test::BUNDLE_PATH, {test::SELF_PATH, test::PLAIN_PLUGIN_PATH});
+    PluginBundle bundle(test::BUNDLE_PATH);
+
+    REQUIRE(bundle.getImage(*bundle.findEntry(test::SELF_IMAGE_NAME))
+            == test::readFile(test::SELF_PATH));
+    REQUIRE(bundle.getImage(*bundle.findEntry(test::PLAIN_IMAGE_NAME))
+            == test::PLAIN_PLUGIN_CONTENT);
+  }
+
+  SECTION("When an image is opened, then it can be read from the process file descriptors")
+  {
+    PluginBundle::write(test::BUNDLE_PATH, {test::PLAIN_PLUGIN_PATH});
+    PluginBundle bundle(test::BUNDLE_PATH);
+    auto fd = bundle.openImage(*bundle.findEntry(test::PLAIN_IMAGE_NAME));
+    auto content = test::readFile("/proc/self/fd/" + std::to_string(fd));
+    close(fd);
+
+    REQUIRE(content == test::PLAIN_PLUGIN_CONTENT);
+  }
+
+  SECTION("When two plugin files have the same name, then the bundle is not written")
+  {
+    REQUIRE_THROWS_AS(PluginBundle::write(test::BUNDLE_PATH, {test::PLAIN_PLUGIN_PATH,
+                                                              test::OTHER_PLAIN_PLUGIN_PATH}),
+                      cppps::PluginBundleException);
+  }
+
+  SECTION("When the file is not a bundle, then it cannot be opened")
+  {
+    REQUIRE_THROWS_AS(PluginBundle(test::PLAIN_PLUGIN_PATH), cppps::PluginBundleException);
+    REQUIRE_THROWS_AS(PluginBundle(test::BUNDLE_PATH), cppps::PluginBundleException);
+  }
+
+  SECTION("When a bundled plugin path is made, then it splits into the bundle and the image")
+  {
+    auto path = cppps::makeBundleEntryPath(test::BUNDLE_PATH, test::PLAIN_IMAGE_NAME);
+    auto bundleEntry = cppps::splitBundleEntryPath(path);
+
+    REQUIRE(std::filesystem::path(path).filename() == test::PLAIN_IMAGE_NAME);
+    REQUIRE(bundleEntry.has_value());
+    REQUIRE(bundleEntry->first == test::BUNDLE_PATH);
+    REQUIRE(bundleEntry->second == test::PLAIN_IMAGE_NAME);
+    REQUIRE_FALSE(cppps::splitBundleEntryPath(test::PLAIN_PLUGIN_PATH).has_value());
+  }
+
+  std::filesystem::remove_all(test::TMP_DIR);
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#define PLUGIN_NAME "described_plugin"
+#define PLUGIN_VERSION "2.1.0"
+#define PLUGIN_PROVIDES "product_a,product_b"
+#define PLUGIN_CONSUMES "logger"
+
+#include "cppps/dl/Export.h"
+#include "cppps/dl/IPlugin.h"
+#include "cppps/dl/PluginDescriptor.h"
+#include "cppps/dl/exceptions.h"
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace test {
+namespace {
+
+const std::string SELF_PATH = "/proc/self/exe";
+const std::string NON_EXISTENT_PATH = "/nonexistent/libplugin_x.so";
+const std::vector<std::string> PROVIDED_KEYS = {"product_a", "product_b"};
+const std::vector<std::string> CONSUMED_KEYS = {"logger"};
+
+class DescribedPlugin: public cppps::IPlugin
+{
+public:
+  std::string getName() const override {return PLUGIN_NAME;}
+  std::string getVersionString() const override {return PLUGIN_VERSION;}
+  void prepare(const cppps::ICliPtr&, cppps::IApplication&) override {}
+  void submitProviders(const cppps::SubmitProvider&) override {}
+  void submitConsumers(const cppps::SubmitConsumer&) override {}
+  void initialize() override {}
+  void start() override {}
+  void stop() override {}
+  void unload() override {}
+};
+
+} // namespace
+} // namespace test
+
+CPPPS_EXPORT_PLUGIN(test::DescribedPlugin)
+
+TEST_CASE("Testing plugin descriptor", "[plugin_descriptor]")
+{
+  SECTION("When the descriptor is built, then its fields are set at compile time")
+  {
+    constexpr auto descriptor = cppps::makePluginDescriptor("a", "1.0", "x,y", "");
+    static_assert(descriptor.name[0] == 'a' && descriptor.name[1] == '\0');
+    static_assert(descriptor.abiVersion == cppps::PLUGIN_ABI_VERSION);
+    static_assert(descriptor.size == sizeof(cppps::PluginDescriptor));
+    REQUIRE(std::string(descriptor.providedKeys) == "x,y");
+  }
+
+  SECTION("When the plugin file is read, "
+          "then the exported descriptor is found without loading the plugin")
+  {
+    auto infos = cppps::readPluginDescriptors(test::SELF_PATH);
+    REQUIRE(infos.size() == 1);
+    REQUIRE(infos.front().name == PLUGIN_NAME);
+    REQUIRE(infos.front().version == PLUGIN_VERSION);
+    REQUIRE(infos.front().providedKeys == test::PROVIDED_KEYS);
+    REQUIRE(infos.front().consumedKeys == test::CONSUMED_KEYS);
+    REQUIRE(infos.front().abiVersion == cppps::PLUGIN_ABI_VERSION);
+  }
+
+  SECTION("When the file does not exist, then the PluginDescriptorException is thrown")
+  {
+    REQUIRE_THROWS_AS(cppps::readPluginDescriptors(test::NON_EXISTENT_PATH),
+                      cppps::PluginDescriptorException);
+  }
+
+  SECTION("When the file is not an ELF file, then the PluginDescriptorException is thrown")
+  {
+    auto path = (std::filesystem::temp_directory_path() / "cppps_not_elf.so").string();
+    std::ofstream(path) << "not an ELF file";
+    REQUIRE_THROWS_AS(cppps::readPluginDescriptors(path), cppps::PluginDescriptorException);
+    std::remove(path.c_str());
+  }
+}
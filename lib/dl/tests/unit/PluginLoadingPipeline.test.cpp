@@ -0,0 +1,117 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "PluginLoadingPipeline.h"
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using cppps::PluginLoadingPipeline;
+
+namespace test {
+namespace {
+
+constexpr auto PLUGIN_VERSION = "1.0.0";
+constexpr auto BROKEN_PLUGIN_PATH = "libbroken.so";
+const PluginLoadingPipeline::Paths PLUGIN_PATHS = {"liba.so", "libb.so", "libc.so"};
+
+class TestPlugin: public cppps::IPlugin
+{
+public:
+  explicit TestPlugin(std::string name): name{std::move(name)} {}
+  std::string getName() const override {return name;}
+  std::string getVersionString() const override {return PLUGIN_VERSION;}
+  void prepare(const cppps::ICliPtr&, cppps::IApplication&) override {}
+  void submitProviders(const cppps::SubmitProvider&) override {}
+  void submitConsumers(const cppps::SubmitConsumer&) override {}
+  void initialize() override {}
+  void start() override {}
+  void stop() override {}
+  void unload() override {}
+
+private:
+  std::string name;
+};
+
+cppps::IPluginDPtr loadPlugin(const std::string& path)
+{
+  if (path == BROKEN_PLUGIN_PATH) {
+    throw std::runtime_error("cannot load " + path);
+  }
+  return cppps::IPluginDPtr(new TestPlugin(path), [](auto* obj){delete obj;});
+}
+
+std::vector<std::string> takeAll(PluginLoadingPipeline& pipeline)
+{
+  std::vector<std::string> names;
+  while (auto plugin = pipeline.next()) {
+    names.push_back(plugin->getName());
+  }
+  return names;
+}
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing plugin loading pipeline", "[plugin_loading_pipeline]")
+{
+  SECTION("When the plugins are loaded, then they are taken in the scanned order")
+  {
+    PluginLoadingPipeline pipeline([](){return test::PLUGIN_PATHS;}, test::loadPlugin);
+    auto names = test::takeAll(pipeline);
+
+    REQUIRE(names == std::vector<std::string>(test::PLUGIN_PATHS.begin(), test::PLUGIN_PATHS.end()));
+    REQUIRE(pipeline.getPaths() == test::PLUGIN_PATHS);
+    REQUIRE(pipeline.next() == nullptr);
+  }
+
+  SECTION("When no plugins are found, then none is taken")
+  {
+    PluginLoadingPipeline pipeline([](){return PluginLoadingPipeline::Paths{};}, test::loadPlugin);
+
+    REQUIRE(pipeline.next() == nullptr);
+    REQUIRE(pipeline.getPaths().empty());
+  }
+
+  SECTION("When a plugin fails to load, then the error is thrown after the plugins loaded before it")
+  {
+    PluginLoadingPipeline pipeline([](){
+      return PluginLoadingPipeline::Paths{"liba.so", test::BROKEN_PLUGIN_PATH, "libc.so"};
+    }, test::loadPlugin);
+
+    auto plugin = pipeline.next();
+    REQUIRE(plugin != nullptr);
+    REQUIRE(plugin->getName() == "liba.so");
+    REQUIRE_THROWS_AS(pipeline.next(), std::runtime_error);
+    REQUIRE(pipeline.next() == nullptr);
+  }
+
+  SECTION("When scanning fails, then the error is thrown by the consumer")
+  {
+    PluginLoadingPipeline pipeline([]() -> PluginLoadingPipeline::Paths {
+      throw std::runtime_error("cannot scan");
+    }, test::loadPlugin);
+
+    REQUIRE_THROWS_AS(pipeline.next(), std::runtime_error);
+  }
+
+  SECTION("When the pipeline is destroyed early, then the remaining plugins are not loaded")
+  {
+    std::atomic<int> loadCount {0};
+    {
+      PluginLoadingPipeline pipeline([](){return test::PLUGIN_PATHS;},
+                                     [&loadCount](const std::string& path){
+                                       ++loadCount;
+                                       return test::loadPlugin(path);
+                                     });
+      REQUIRE(pipeline.next() != nullptr);
+    }
+
+    REQUIRE(loadCount >= 1);
+    REQUIRE(loadCount <= static_cast<int>(test::PLUGIN_PATHS.size()));
+  }
+}
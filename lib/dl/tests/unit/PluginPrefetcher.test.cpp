@@ -0,0 +1,65 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "PluginPrefetcher.h"
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using cppps::PluginPrefetcher;
+
+namespace test {
+namespace {
+
+const auto TMP_DIR = std::filesystem::temp_directory_path() / "cppps_plugin_prefetcher_test";
+const auto PLUGIN_A_PATH = (TMP_DIR / "libplugin_a.so").string();
+const auto PLUGIN_B_PATH = (TMP_DIR / "libplugin_b.so").string();
+const auto MISSING_PLUGIN_PATH = (TMP_DIR / "libmissing.so").string();
+
+void writeFile(const std::string& path, const std::string& content)
+{
+  std::ofstream(path) << content;
+}
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing plugin prefetcher", "[plugin_prefetcher]")
+{
+  std::filesystem::remove_all(test::TMP_DIR);
+  std::filesystem::create_directories(test::TMP_DIR);
+  test::writeFile(test::PLUGIN_A_PATH, std::string(1 << 16, 'a'));
+  test::writeFile(test::PLUGIN_B_PATH, std::string(1 << 16, 'b'));
+
+  SECTION("When the files are sorted by disk location, then all of them are kept")
+  {
+    auto paths = PluginPrefetcher::sortByDiskLocation({test::PLUGIN_B_PATH, test::PLUGIN_A_PATH});
+    paths.sort();
+
+    REQUIRE(paths == PluginPrefetcher::Paths{test::PLUGIN_A_PATH, test::PLUGIN_B_PATH});
+  }
+
+  SECTION("When a file cannot be examined, then it goes last")
+  {
+    auto paths = PluginPrefetcher::sortByDiskLocation({test::MISSING_PLUGIN_PATH,
+                                                       test::PLUGIN_A_PATH});
+
+    REQUIRE(paths == PluginPrefetcher::Paths{test::PLUGIN_A_PATH, test::MISSING_PLUGIN_PATH});
+  }
+
+  SECTION("When the files are prefetched, then missing files are ignored")
+  {
+    {
+      PluginPrefetcher prefetcher;
+      prefetcher.prefetch({test::PLUGIN_A_PATH, test::MISSING_PLUGIN_PATH});
+      prefetcher.prefetch({test::PLUGIN_B_PATH});
+    }
+
+    REQUIRE(std::filesystem::file_size(test::PLUGIN_A_PATH) == (1 << 16));
+  }
+
+  std::filesystem::remove_all(test::TMP_DIR);
+}
@@ -0,0 +1,127 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/PluginSelection.h"
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using cppps::PluginSelection;
+
+namespace test {
+namespace {
+
+const auto CONFIG_PATH = (std::filesystem::temp_directory_path()
+                          / "cppps_plugin_selection.ini").string();
+
+class Args
+{
+public:
+  Args(std::initializer_list<std::string> values): args{values}
+  {
+    for (auto& arg: args) {
+      argv.push_back(arg.data());
+    }
+  }
+
+  int argc() {return static_cast<int>(argv.size());}
+  char** data() {return argv.data();}
+
+private:
+  std::vector<std::string> args;
+  std::vector<char*> argv;
+};
+
+void writeConfig(const std::string& content)
+{
+  std::ofstream(CONFIG_PATH) << content;
+}
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing plugin selection", "[plugin_selection]")
+{
+  PluginSelection selection;
+
+  SECTION("When no patterns were given, then every plugin is selected")
+  {
+    test::Args args {"app", "--other", "value"};
+    selection.parse(args.argc(), args.data());
+
+    REQUIRE_FALSE(selection.isRestricted());
+    REQUIRE(selection.isSelected("plugin_a"));
+  }
+
+  SECTION("When include patterns were given, then only the matching plugins are selected")
+  {
+    test::Args args {"app", "--plugins", "logger, net_*", "--plugins=db?"};
+    selection.parse(args.argc(), args.data());
+
+    REQUIRE(selection.getIncludePatterns().size() == 3);
+    REQUIRE(selection.isSelected("logger"));
+    REQUIRE(selection.isSelected("net_http"));
+    REQUIRE(selection.isSelected("db1"));
+    REQUIRE_FALSE(selection.isSelected("db12"));
+    REQUIRE_FALSE(selection.isSelected("metrics"));
+  }
+
+  SECTION("When exclude patterns were given, then the matching plugins are not selected")
+  {
+    test::Args args {"app", "--plugins", "*", "--disable-plugins", "*_debug"};
+    selection.parse(args.argc(), args.data());
+
+    REQUIRE(selection.isSelected("logger"));
+    REQUIRE_FALSE(selection.isSelected("logger_debug"));
+  }
+
+  SECTION("When the patterns are given after the end of options, then they are ignored")
+  {
+    test::Args args {"app", "--", "--plugins", "logger"};
+    selection.parse(args.argc(), args.data());
+
+    REQUIRE_FALSE(selection.isRestricted());
+  }
+
+  SECTION("When the config file contains the patterns, then they are read")
+  {
+    test::writeConfig("; comment\n"
+                      "plugins = [\"logger\", \"db\"]\n"
+                      "disable-plugins = db\n"
+                      "[other]\n"
+                      "plugins = metrics\n");
+    test::Args args {"app", "-c", test::CONFIG_PATH};
+    selection.parse(args.argc(), args.data());
+
+    REQUIRE(selection.isSelected("logger"));
+    REQUIRE_FALSE(selection.isSelected("db"));
+    REQUIRE_FALSE(selection.isSelected("metrics"));
+    std::remove(test::CONFIG_PATH.c_str());
+  }
+
+  SECTION("When the patterns are given in both the config file and the command line, "
+          "then the command line overrides the config file")
+  {
+    test::writeConfig("plugins = logger\n"
+                      "disable-plugins = db\n");
+    test::Args args {"app", "--config=" + test::CONFIG_PATH, "--plugins", "db"};
+    selection.parse(args.argc(), args.data());
+
+    REQUIRE_FALSE(selection.isSelected("logger"));
+    REQUIRE_FALSE(selection.isSelected("db"));
+    REQUIRE(selection.getExcludePatterns().size() == 1);
+    std::remove(test::CONFIG_PATH.c_str());
+  }
+
+  SECTION("When the config file does not exist, then no exception is thrown")
+  {
+    test::Args args {"app", "-c/nonexistent/config.ini"};
+    REQUIRE_NOTHROW(selection.parse(args.argc(), args.data()));
+    REQUIRE_FALSE(selection.isRestricted());
+  }
+}
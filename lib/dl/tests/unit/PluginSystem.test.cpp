@@ -17,7 +17,10 @@
 #include <vector>
 #include <functional>
 #include <any>
+#include <chrono>
 #include <list>
+#include <thread>
+#include <stdexcept>
 
 using namespace fakeit;
 using namespace cppps;
@@ -37,14 +40,20 @@ namespace {
 constexpr auto PLUGIN_A_NAME = "A";
 constexpr auto PLUGIN_B_NAME = "B";
 constexpr auto PLUGIN_C_NAME = "C";
+constexpr auto PLUGIN_D_NAME = "D";
 constexpr auto PRODUCT_A_KEY = "product_a";
 constexpr auto PRODUCT_A_VALUE = "the value of product A";
+constexpr auto PRODUCT_A_NEW_VALUE = "the value of reloaded product A";
 constexpr auto PRODUCT_X_KEY = "product_x";
 const std::string PREPARE_TAG = "_init";
 const std::string INIT_TAG = "_init";
 const std::string START_TAG = "_start";
 const std::string STOP_TAG = "_stop";
 const std::string UNLOAD_TAG = "_unload";
+constexpr auto SHORT_STOP_DEADLINE = std::chrono::milliseconds(5);
+constexpr auto LONG_STOP_DEADLINE = std::chrono::milliseconds(10000);
+constexpr auto SLOW_STOP_DURATION = std::chrono::milliseconds(50);
+constexpr auto SLOW_INIT_DURATION = std::chrono::milliseconds(20);
 
 struct Fixture
 {
@@ -77,22 +86,22 @@ struct Fixture
   void setupLifecycleMethods(Mock<IPlugin>& plugin, std::string_view name)
   {
     When(Method(plugin, getName)).AlwaysDo([name](){return name.data();});
-    When(Method(plugin, prepare)).Do([this, name](auto, auto&){
+    When(Method(plugin, prepare)).AlwaysDo([this, name](auto, auto&){
       processedPlugins.push_back(name.data() + test::PREPARE_TAG);});
-    When(Method(plugin, initialize)).Do([this, name](){
+    When(Method(plugin, initialize)).AlwaysDo([this, name](){
       processedPlugins.push_back(name.data() + test::INIT_TAG);});
-    When(Method(plugin, start)).Do([this, name](){
+    When(Method(plugin, start)).AlwaysDo([this, name](){
       processedPlugins.push_back(name.data() + test::START_TAG);});
-    When(Method(plugin, stop)).Do([this, name](){
+    When(Method(plugin, stop)).AlwaysDo([this, name](){
       processedPlugins.push_back(name.data() + test::STOP_TAG);});
-    When(Method(plugin, unload)).Do([this, name](){
+    When(Method(plugin, unload)).AlwaysDo([this, name](){
       processedPlugins.push_back(name.data() + test::UNLOAD_TAG);});
   }
 
   void setupPluginADependencies()
   {
     Fake(Method(pluginA, submitConsumers));
-    When(Method(pluginA, submitProviders)).Do([](SubmitProvider submit) {
+    When(Method(pluginA, submitProviders)).AlwaysDo([](SubmitProvider submit) {
       auto providerA = []() {
         return std::make_shared<ProductA>(test::PRODUCT_A_VALUE);
       };
@@ -103,7 +112,7 @@ struct Fixture
   void setupPluginBDependencies()
   {
     Fake(Method(pluginB, submitProviders));
-    When(Method(pluginB, submitConsumers)).Do([this](SubmitConsumer submit) {
+    When(Method(pluginB, submitConsumers)).AlwaysDo([this](SubmitConsumer submit) {
       auto consumer = [this](const Resource& res) {
         productAPtr = res.as<ProductAPtr>();
       };
@@ -149,6 +158,14 @@ TEST_CASE_METHOD(test::Fixture, "Testing plugins initialization", "[ps_init]")
     REQUIRE(productAPtr->value == test::PRODUCT_A_VALUE);
   }
 
+  SECTION("When the initialization stage is done, then all products are available in the resource registry")
+  {
+    pluginSystem.initialize();
+    auto product = pluginSystem.getResourceRegistry().get<ProductAPtr>(test::PRODUCT_A_KEY);
+    REQUIRE(product != nullptr);
+    REQUIRE(product->value == test::PRODUCT_A_VALUE);
+  }
+
   SECTION("When consumer requirements are not satisfied, then an exception is thrown")
   {
     Fake(Method(pluginC, submitProviders));
@@ -210,6 +227,52 @@ TEST_CASE_METHOD(test::Fixture, "Testing plugin life cycle", "[ps_cycle]")
     REQUIRE(processedPlugins.at(1) == test::PLUGIN_A_NAME + test::STOP_TAG);
   }
 
+  SECTION("When a plugin is stopped, then the plugin-stopped hooks are called with its name")
+  {
+    pluginSystem.addOnPluginStoppedHook([this](const std::string& name){
+      processedPlugins.push_back(name + "_hook");
+    });
+    pluginSystem.stop();
+    REQUIRE(processedPlugins == std::vector<std::string>{
+      test::PLUGIN_B_NAME + test::STOP_TAG, test::PLUGIN_B_NAME + std::string("_hook"),
+      test::PLUGIN_A_NAME + test::STOP_TAG, test::PLUGIN_A_NAME + std::string("_hook")});
+  }
+
+  SECTION("When a plugin-stopped hook is removed, then it is not called any more")
+  {
+    auto hookId = pluginSystem.addOnPluginStoppedHook([this](const std::string& name){
+      processedPlugins.push_back(name + "_hook");
+    });
+    pluginSystem.removeOnPluginStoppedHook(hookId);
+    pluginSystem.stop();
+    REQUIRE(processedPlugins == std::vector<std::string>{
+      test::PLUGIN_B_NAME + test::STOP_TAG, test::PLUGIN_A_NAME + test::STOP_TAG});
+  }
+
+  SECTION("When a plugin exceeds its stop deadline, then it is reported by the deadline hook and in the stop report")
+  {
+    std::vector<std::string> exceededPlugins;
+    pluginSystem.setOnStopDeadlineExceededHook([&exceededPlugins](const auto& name, auto){
+      exceededPlugins.push_back(name);
+    });
+    pluginSystem.setDefaultStopDeadline(test::LONG_STOP_DEADLINE);
+    pluginSystem.setStopDeadline(test::PLUGIN_B_NAME, test::SHORT_STOP_DEADLINE);
+    When(Method(pluginB, stop)).Do([](){std::this_thread::sleep_for(test::SLOW_STOP_DURATION);});
+
+    pluginSystem.stop();
+    REQUIRE(exceededPlugins == std::vector<std::string>{test::PLUGIN_B_NAME});
+
+    const auto& report = pluginSystem.getStopReport();
+    REQUIRE(report.size() == 2);
+    REQUIRE(report.front().pluginName == test::PLUGIN_B_NAME);
+    REQUIRE(report.front().deadline == test::SHORT_STOP_DEADLINE);
+    REQUIRE(report.front().duration >= test::SLOW_STOP_DURATION);
+    REQUIRE(report.front().deadlineExceeded);
+    REQUIRE(report.back().pluginName == test::PLUGIN_A_NAME);
+    REQUIRE(report.back().deadline == test::LONG_STOP_DEADLINE);
+    REQUIRE_FALSE(report.back().deadlineExceeded);
+  }
+
   SECTION("When the unloading stage is done, then all the plugins should be unloaded in reverse dependency order")
   {
     pluginSystem.unload();
@@ -217,9 +280,297 @@ TEST_CASE_METHOD(test::Fixture, "Testing plugin life cycle", "[ps_cycle]")
     REQUIRE(processedPlugins.at(1) == test::PLUGIN_A_NAME + test::UNLOAD_TAG);
   }
 
+  SECTION("When the unloading stage is done, then the resource registry is empty")
+  {
+    pluginSystem.unload();
+    REQUIRE_FALSE(pluginSystem.getResourceRegistry().contains(test::PRODUCT_A_KEY));
+  }
+
   //TODO: should the unload() method be called after an exception is thrown?
 }
 
+TEST_CASE_METHOD(test::Fixture, "Testing incremental plugin initialization", "[ps_incremental]")
+{
+  PluginSystem pluginSystem;
+  pluginSystem.mergePlugins(plugins);
+  pluginSystem.initialize();
+  pluginSystem.start();
+  processedPlugins.clear();
+
+  PluginSystem::LoadedPlugins extraPlugins;
+  extraPlugins.emplace_back(IPluginDPtr(&pluginC.get(), [](auto*){}));
+
+  SECTION("When a plugin is added after the start, then it is resolved against the running plugins "
+          "and only the added plugin is initialized and started")
+  {
+    ProductAPtr productForC {nullptr};
+    Fake(Method(pluginC, submitProviders));
+    When(Method(pluginC, submitConsumers)).Do([&productForC](const SubmitConsumer& submit) {
+      submit(test::PRODUCT_A_KEY, [&productForC](const Resource& res) {
+        productForC = res.as<ProductAPtr>();
+      });
+    });
+
+    pluginSystem.mergePlugins(extraPlugins);
+    pluginSystem.initialize();
+    pluginSystem.start();
+
+    REQUIRE(processedPlugins == std::vector<std::string>{
+      test::PLUGIN_C_NAME + test::INIT_TAG, test::PLUGIN_C_NAME + test::START_TAG});
+    REQUIRE(productForC == productAPtr);
+  }
+
+  SECTION("When an added plugin has already been initialized, then an exception is thrown")
+  {
+    When(Method(pluginC, getName)).AlwaysReturn(test::PLUGIN_A_NAME);
+    pluginSystem.mergePlugins(extraPlugins);
+
+    REQUIRE_THROWS_AS(pluginSystem.initialize(), DuplicatedPluginException);
+  }
+
+  SECTION("When the plugins are stopped, then the added plugins are stopped before their providers")
+  {
+    Fake(Method(pluginC, submitProviders));
+    When(Method(pluginC, submitConsumers)).Do([](const SubmitConsumer& submit) {
+      submit(test::PRODUCT_A_KEY, [](const Resource&) {});
+    });
+
+    pluginSystem.mergePlugins(extraPlugins);
+    pluginSystem.initialize();
+    pluginSystem.start();
+    processedPlugins.clear();
+    pluginSystem.stop();
+
+    REQUIRE(processedPlugins == std::vector<std::string>{
+      test::PLUGIN_C_NAME + test::STOP_TAG, test::PLUGIN_B_NAME + test::STOP_TAG,
+      test::PLUGIN_A_NAME + test::STOP_TAG});
+  }
+
+  SECTION("When an added plugin fails to initialize, then the plugins initialized before it "
+          "keep their resources and are stopped with the others")
+  {
+    fakeit::Mock<IPlugin> pluginD;
+    When(Method(pluginD, getName)).AlwaysReturn(test::PLUGIN_D_NAME);
+    Fake(Method(pluginD, submitProviders));
+    When(Method(pluginD, submitConsumers)).Do([](const SubmitConsumer& submit) {
+      submit(test::PRODUCT_X_KEY, [](const Resource&) {});
+    });
+    When(Method(pluginD, initialize)).Throw(std::runtime_error("initialization failed"));
+    Fake(Method(pluginC, submitConsumers));
+    When(Method(pluginC, submitProviders)).Do([](SubmitProvider submit) {
+      submit(test::PRODUCT_X_KEY, [](){return std::make_shared<int>(0);});
+    });
+
+    extraPlugins.emplace_back(IPluginDPtr(&pluginD.get(), [](auto*){}));
+    pluginSystem.mergePlugins(extraPlugins);
+    REQUIRE_THROWS_AS(pluginSystem.initialize(), std::runtime_error);
+    REQUIRE(pluginSystem.getResourceRegistry().contains(test::PRODUCT_X_KEY));
+
+    processedPlugins.clear();
+    pluginSystem.stop();
+    REQUIRE(processedPlugins == std::vector<std::string>{
+      test::PLUGIN_C_NAME + test::STOP_TAG, test::PLUGIN_B_NAME + test::STOP_TAG,
+      test::PLUGIN_A_NAME + test::STOP_TAG});
+  }
+}
+
+TEST_CASE_METHOD(test::Fixture, "Testing plugin reload", "[ps_reload]")
+{
+  PluginSystem pluginSystem;
+  pluginSystem.mergePlugins(plugins);
+  pluginSystem.initialize();
+  pluginSystem.start();
+  processedPlugins.clear();
+
+  // plugin C replaces plugin A
+  When(Method(pluginC, getName)).AlwaysReturn(test::PLUGIN_A_NAME);
+  Fake(Method(pluginC, submitConsumers));
+  When(Method(pluginC, submitProviders)).Do([](SubmitProvider submit) {
+    submit(test::PRODUCT_A_KEY, [](){
+      return std::make_shared<ProductA>(test::PRODUCT_A_NEW_VALUE);
+    });
+  });
+
+  SECTION("When a plugin is reloaded, then its consumers are restarted in the dependency order "
+          "and get the resources of the new plugin")
+  {
+    pluginSystem.reload(IPluginDPtr(&pluginC.get(), [](auto*){}), cliPtr, app.get());
+
+    REQUIRE(processedPlugins == std::vector<std::string>{
+      test::PLUGIN_B_NAME + test::STOP_TAG, test::PLUGIN_A_NAME + test::STOP_TAG,
+      test::PLUGIN_C_NAME + test::PREPARE_TAG, test::PLUGIN_C_NAME + test::INIT_TAG,
+      test::PLUGIN_B_NAME + test::INIT_TAG, test::PLUGIN_C_NAME + test::START_TAG,
+      test::PLUGIN_B_NAME + test::START_TAG, test::PLUGIN_A_NAME + test::UNLOAD_TAG});
+    REQUIRE(productAPtr->value == test::PRODUCT_A_NEW_VALUE);
+    REQUIRE(pluginSystem.getResourceRegistry().get<ProductAPtr>(test::PRODUCT_A_KEY)->value
+            == test::PRODUCT_A_NEW_VALUE);
+  }
+
+  SECTION("When a plugin is reloaded, then its consumers are stopped like in the stopping stage")
+  {
+    pluginSystem.addOnPluginStoppedHook([this](const std::string& name){
+      processedPlugins.push_back(name + "_hook");
+    });
+    pluginSystem.setDefaultStopDeadline(test::LONG_STOP_DEADLINE);
+    pluginSystem.reload(IPluginDPtr(&pluginC.get(), [](auto*){}), cliPtr, app.get());
+
+    REQUIRE(processedPlugins.at(1) == test::PLUGIN_B_NAME + std::string("_hook"));
+    REQUIRE(processedPlugins.at(3) == test::PLUGIN_A_NAME + std::string("_hook"));
+    const auto& report = pluginSystem.getStopReport();
+    REQUIRE(report.size() == 2);
+    REQUIRE(report.front().pluginName == test::PLUGIN_B_NAME);
+    REQUIRE(report.back().deadline == test::LONG_STOP_DEADLINE);
+  }
+
+  SECTION("When a reloaded plugin fails to start, then the previous plugin is restored "
+          "for its consumers and the exception is rethrown")
+  {
+    When(Method(pluginC, start)).Do([this](){
+      processedPlugins.push_back(test::PLUGIN_C_NAME + test::START_TAG);
+      throw std::runtime_error("starting failed");
+    });
+
+    REQUIRE_THROWS_AS(pluginSystem.reload(IPluginDPtr(&pluginC.get(), [](auto*){}), cliPtr, app.get()),
+                      std::runtime_error);
+
+    REQUIRE(processedPlugins == std::vector<std::string>{
+      test::PLUGIN_B_NAME + test::STOP_TAG, test::PLUGIN_A_NAME + test::STOP_TAG,
+      test::PLUGIN_C_NAME + test::PREPARE_TAG, test::PLUGIN_C_NAME + test::INIT_TAG,
+      test::PLUGIN_B_NAME + test::INIT_TAG, test::PLUGIN_C_NAME + test::START_TAG,
+      test::PLUGIN_B_NAME + test::STOP_TAG, test::PLUGIN_C_NAME + test::STOP_TAG,
+      test::PLUGIN_C_NAME + test::UNLOAD_TAG, test::PLUGIN_A_NAME + test::INIT_TAG,
+      test::PLUGIN_B_NAME + test::INIT_TAG, test::PLUGIN_A_NAME + test::START_TAG,
+      test::PLUGIN_B_NAME + test::START_TAG});
+    REQUIRE(productAPtr->value == test::PRODUCT_A_VALUE);
+    REQUIRE(pluginSystem.getResourceRegistry().get<ProductAPtr>(test::PRODUCT_A_KEY)->value
+            == test::PRODUCT_A_VALUE);
+
+    processedPlugins.clear();
+    pluginSystem.stop();
+    REQUIRE(processedPlugins == std::vector<std::string>{
+      test::PLUGIN_B_NAME + test::STOP_TAG, test::PLUGIN_A_NAME + test::STOP_TAG});
+  }
+
+  SECTION("When a plugin that is not running is reloaded, then an exception is thrown")
+  {
+    When(Method(pluginC, getName)).AlwaysReturn(test::PLUGIN_C_NAME);
+    REQUIRE_THROWS_AS(pluginSystem.reload(IPluginDPtr(&pluginC.get(), [](auto*){}), cliPtr, app.get()),
+                      PluginReloadException);
+  }
+}
+
+TEST_CASE_METHOD(test::Fixture, "Testing startup report", "[ps_startup_report]")
+{
+  // plugin C has no dependencies and initializes quickly
+  plugins.emplace_back(IPluginDPtr(&pluginC.get(), [](auto*){}));
+  Fake(Method(pluginC, submitProviders));
+  Fake(Method(pluginC, submitConsumers));
+
+  PluginSystem pluginSystem;
+  pluginSystem.mergePlugins(plugins);
+  When(Method(pluginA, initialize)).Do([](){std::this_thread::sleep_for(test::SLOW_INIT_DURATION);});
+
+  SECTION("When the plugins are initialized, then the chain of providers bounding the boot time "
+          "is reported as the critical path")
+  {
+    pluginSystem.initialize();
+    auto report = pluginSystem.getStartupReport();
+
+    REQUIRE(report.criticalPath == std::list<std::string>{test::PLUGIN_A_NAME, test::PLUGIN_B_NAME});
+    REQUIRE(report.plugins.size() == 3);
+    for (const auto& entry: report.plugins) {
+      if (entry.pluginName == test::PLUGIN_C_NAME) {
+        REQUIRE_FALSE(entry.critical);
+        REQUIRE(entry.slack == report.parallelTime - entry.duration);
+      }
+      else {
+        REQUIRE(entry.critical);
+        REQUIRE(entry.slack.count() == 0);
+      }
+    }
+    REQUIRE(report.parallelTime >= test::SLOW_INIT_DURATION);
+    REQUIRE(report.parallelTime <= report.serialTime);
+  }
+
+  SECTION("When the plugins are unloaded, then the startup report is empty")
+  {
+    pluginSystem.initialize();
+    pluginSystem.unload();
+    auto report = pluginSystem.getStartupReport();
+
+    REQUIRE(report.plugins.empty());
+    REQUIRE(report.criticalPath.empty());
+    REQUIRE(report.parallelTime.count() == 0);
+  }
+}
+
+TEST_CASE_METHOD(test::Fixture, "Testing parallel plugin life cycle", "[ps_parallel]")
+{
+  PluginSystem pluginSystem;
+  pluginSystem.mergePlugins(plugins);
+  pluginSystem.setLifecycleMode(PluginSystem::LifecycleMode::PARALLEL);
+  pluginSystem.initialize();
+  processedPlugins.clear();
+
+  SECTION("When the plugins are started in parallel, then the providers are started before their consumers")
+  {
+    pluginSystem.start();
+    REQUIRE(processedPlugins == std::vector<std::string>{
+      test::PLUGIN_A_NAME + test::START_TAG, test::PLUGIN_B_NAME + test::START_TAG});
+  }
+
+  SECTION("When the plugins are stopped in parallel, then the consumers are stopped before their providers")
+  {
+    pluginSystem.stop();
+    REQUIRE(processedPlugins == std::vector<std::string>{
+      test::PLUGIN_B_NAME + test::STOP_TAG, test::PLUGIN_A_NAME + test::STOP_TAG});
+  }
+
+  SECTION("When the start phase times out, then an exception is thrown and the remaining plugins are not started")
+  {
+    pluginSystem.setPhaseTimeout(test::SHORT_STOP_DEADLINE);
+    When(Method(pluginA, start)).Do([](){std::this_thread::sleep_for(test::SLOW_STOP_DURATION);});
+
+    REQUIRE_THROWS_AS(pluginSystem.start(), LifecycleTimeoutException);
+    REQUIRE(processedPlugins.empty());
+  }
+
+  SECTION("When the start phase has timed out, then the next start starts only the remaining plugins")
+  {
+    pluginSystem.setPhaseTimeout(test::SHORT_STOP_DEADLINE);
+    When(Method(pluginA, start)).Do([](){std::this_thread::sleep_for(test::SLOW_STOP_DURATION);});
+    REQUIRE_THROWS_AS(pluginSystem.start(), LifecycleTimeoutException);
+
+    pluginSystem.start();
+    REQUIRE(processedPlugins == std::vector<std::string>{test::PLUGIN_B_NAME + test::START_TAG});
+  }
+
+  SECTION("When a plugin fails to start, then the next start starts it again")
+  {
+    When(Method(pluginB, start)).Throw(std::runtime_error("start failed")).AlwaysDo([this](){
+      processedPlugins.push_back(test::PLUGIN_B_NAME + test::START_TAG);});
+    REQUIRE_THROWS_AS(pluginSystem.start(), std::runtime_error);
+
+    pluginSystem.start();
+    REQUIRE(processedPlugins == std::vector<std::string>{
+      test::PLUGIN_A_NAME + test::START_TAG, test::PLUGIN_B_NAME + test::START_TAG});
+  }
+
+  SECTION("When the stop phase times out, then the remaining plugins are stopped without waiting for their consumers")
+  {
+    pluginSystem.setPhaseTimeout(test::SHORT_STOP_DEADLINE);
+    When(Method(pluginB, stop)).Do([](){std::this_thread::sleep_for(test::SLOW_STOP_DURATION);});
+
+    pluginSystem.stop();
+    REQUIRE(processedPlugins == std::vector<std::string>{test::PLUGIN_A_NAME + test::STOP_TAG});
+    const auto& report = pluginSystem.getStopReport();
+    REQUIRE(report.size() == 2);
+    REQUIRE(report.front().pluginName == test::PLUGIN_A_NAME);
+    REQUIRE(report.front().forced);
+    REQUIRE_FALSE(report.back().forced);
+  }
+}
+
 
 namespace test {
 namespace {
@@ -0,0 +1,136 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/ResourceRegistry.h"
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using cppps::ResourceRegistry;
+using cppps::Resource;
+using cppps::NoSuchResourceException;
+using cppps::TypeMismatchException;
+
+namespace test {
+namespace {
+
+constexpr auto KEY_A = "resource_a";
+constexpr auto KEY_B = "resource_b";
+constexpr auto KEY_X = "resource_x";
+constexpr int VALUE_A = 25;
+constexpr int VALUE_B = 26;
+constexpr int READER_THREADS = 4;
+constexpr int UPDATES = 100;
+
+ResourceRegistry::Resources makeResources(std::string_view key, int value)
+{
+  ResourceRegistry::Resources resources;
+  resources.emplace(key, std::make_shared<int>(value));
+  return resources;
+}
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing resource registry lookups", "[rr_lookup]")
+{
+  ResourceRegistry registry;
+
+  SECTION("When nothing was published, then the registry is empty")
+  {
+    REQUIRE_FALSE(registry.contains(test::KEY_A));
+    REQUIRE(registry.getVersion() == 0);
+  }
+
+  SECTION("When a resource is published, then it can be found by its key")
+  {
+    registry.publish(test::makeResources(test::KEY_A, test::VALUE_A));
+    REQUIRE(registry.contains(test::KEY_A));
+    REQUIRE(*registry.get<std::shared_ptr<int>>(test::KEY_A) == test::VALUE_A);
+  }
+
+  SECTION("When a non-existent resource is requested, then an exception is thrown")
+  {
+    REQUIRE_THROWS_AS(registry.get<std::shared_ptr<int>>(test::KEY_X),
+                      NoSuchResourceException);
+  }
+
+  SECTION("When a resource is requested with wrong type, then an exception is thrown")
+  {
+    registry.publish(test::makeResources(test::KEY_A, test::VALUE_A));
+    REQUIRE_THROWS_AS(registry.get<int>(test::KEY_A), TypeMismatchException);
+  }
+
+  SECTION("When resources are published twice, then both sets are available")
+  {
+    registry.publish(test::makeResources(test::KEY_A, test::VALUE_A));
+    registry.publish(test::makeResources(test::KEY_B, test::VALUE_B));
+    REQUIRE(registry.contains(test::KEY_A));
+    REQUIRE(registry.contains(test::KEY_B));
+    REQUIRE(registry.getVersion() == 2);
+  }
+
+  SECTION("When the registry is cleared, then no resources are available")
+  {
+    registry.publish(test::makeResources(test::KEY_A, test::VALUE_A));
+    registry.clear();
+    REQUIRE_FALSE(registry.contains(test::KEY_A));
+  }
+}
+
+TEST_CASE("Testing resource registry handles", "[rr_handle]")
+{
+  ResourceRegistry registry;
+  registry.publish(test::makeResources(test::KEY_A, test::VALUE_A));
+
+  SECTION("When a handle is used, then it returns the resource value")
+  {
+    auto handle = registry.getHandle<std::shared_ptr<int>>(test::KEY_A);
+    REQUIRE(**handle == test::VALUE_A);
+  }
+
+  SECTION("When a resource is replaced, then the handle returns the new value")
+  {
+    auto handle = registry.getHandle<std::shared_ptr<int>>(test::KEY_A);
+    REQUIRE(**handle == test::VALUE_A);
+
+    registry.publish(test::makeResources(test::KEY_A, test::VALUE_B));
+    REQUIRE(**handle == test::VALUE_B);
+  }
+
+  SECTION("When the registry is updated concurrently, then the readers always get a valid value")
+  {
+    std::atomic_bool done {false};
+    std::atomic_int failures {0};
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < test::READER_THREADS; ++i) {
+      readers.emplace_back([&registry, &done, &failures](){
+        auto handle = registry.getHandle<std::shared_ptr<int>>(test::KEY_A);
+        while (!done) {
+          auto value = **handle;
+          if (value < test::VALUE_A || value > test::VALUE_A + test::UPDATES) {
+            ++failures;
+          }
+        }
+      });
+    }
+
+    for (int i = 1; i <= test::UPDATES; ++i) {
+      registry.publish(test::makeResources(test::KEY_A, test::VALUE_A + i));
+    }
+    done = true;
+
+    for (auto& reader: readers) {
+      reader.join();
+    }
+
+    REQUIRE(failures == 0);
+    REQUIRE(*registry.get<std::shared_ptr<int>>(test::KEY_A) == test::VALUE_A + test::UPDATES);
+  }
+}
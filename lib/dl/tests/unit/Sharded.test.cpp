@@ -0,0 +1,101 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/Sharded.h"
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using cppps::Sharded;
+using cppps::ShardSelection;
+
+namespace test {
+namespace {
+
+constexpr size_t SHARDS = 4;
+constexpr int THREADS = 8;
+constexpr int INCREMENTS = 10000;
+
+struct Counter
+{
+  explicit Counter(size_t shard): shard{shard} {}
+  const size_t shard;
+  std::atomic<int64_t> value {0};
+};
+
+int64_t sum(int64_t total, const Counter& counter)
+{
+  return total + counter.value.load();
+}
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing sharded resources", "[sharded]")
+{
+  std::vector<size_t> createdShards;
+  Sharded<test::Counter> counters([&createdShards](size_t shard){
+    createdShards.push_back(shard);
+    return test::Counter(shard);
+  }, test::SHARDS);
+
+  SECTION("When a sharded resource is created, then the factory is called once per shard")
+  {
+    REQUIRE(counters.size() == test::SHARDS);
+    REQUIRE(createdShards == std::vector<size_t>{0, 1, 2, 3});
+    REQUIRE(counters.at(2).shard == 2);
+  }
+
+  SECTION("When the shards are accessed, then every shard occupies separate cache lines")
+  {
+    auto first = reinterpret_cast<uintptr_t>(&counters.at(0));
+    auto second = reinterpret_cast<uintptr_t>(&counters.at(1));
+    REQUIRE(second - first >= 64);
+    REQUIRE(first % 64 == 0);
+  }
+
+  SECTION("When a shard out of range is requested, then an exception is thrown")
+  {
+    REQUIRE_THROWS_AS(counters.at(test::SHARDS), std::out_of_range);
+  }
+
+  SECTION("When the shards are updated by multiple threads, then the aggregated value is complete")
+  {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < test::THREADS; ++i) {
+      threads.emplace_back([&counters](){
+        for (int j = 0; j < test::INCREMENTS; ++j) {
+          counters.local().value.fetch_add(1, std::memory_order_relaxed);
+        }
+      });
+    }
+    for (auto& thread: threads) {
+      thread.join();
+    }
+
+    REQUIRE(counters.aggregate(int64_t{0}, test::sum) == test::THREADS * test::INCREMENTS);
+  }
+}
+
+TEST_CASE("Testing sharded resources selection", "[sharded_selection]")
+{
+  auto counters = cppps::makeSharded<test::Counter>([](size_t shard){
+    return test::Counter(shard);
+  }, test::SHARDS, ShardSelection::THREAD);
+
+  SECTION("When thread selection is used, then a thread always gets the same shard")
+  {
+    auto& first = counters->local();
+    auto& second = counters->local();
+    REQUIRE(&first == &second);
+  }
+
+  SECTION("When the number of shards is zero, then an exception is thrown")
+  {
+    REQUIRE_THROWS_AS(Sharded<int>([](size_t){return 0;}, 0), std::invalid_argument);
+  }
+}
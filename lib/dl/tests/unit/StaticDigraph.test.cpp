@@ -0,0 +1,113 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/StaticDigraph.h"
+#include "cppps/dl/exceptions.h"
+#include <catch2/catch.hpp>
+
+#include <stdexcept>
+#include <string_view>
+
+using cppps::StaticDigraph;
+using cppps::CircularDependencyException;
+using cppps::DuplicatedNodeException;
+using cppps::NoSuchNodeException;
+
+namespace test {
+namespace {
+
+constexpr std::string_view LOGGER = "logger";
+constexpr std::string_view DATABASE = "database";
+constexpr std::string_view CACHE = "cache";
+constexpr std::string_view API = "api";
+constexpr size_t CAPACITY = 4;
+
+using Graph = StaticDigraph<CAPACITY>;
+
+// api -> database -> logger, api -> cache -> logger
+constexpr Graph makeGraph()
+{
+  Graph graph;
+  graph.addNode(API);
+  graph.addNode(DATABASE);
+  graph.addNode(CACHE);
+  graph.addNode(LOGGER);
+  graph.addEdge(API, DATABASE);
+  graph.addEdge(API, CACHE);
+  graph.addEdge(DATABASE, LOGGER);
+  graph.addEdge(CACHE, LOGGER);
+  return graph;
+}
+
+constexpr size_t positionOf(const Graph::SortedKeys& sortedKeys, std::string_view key)
+{
+  for (size_t i = 0; i < sortedKeys.size(); ++i) {
+    if (sortedKeys[i] == key) {
+      return i;
+    }
+  }
+  return sortedKeys.size();
+}
+
+constexpr auto GRAPH = makeGraph();
+constexpr auto INIT_ORDER = GRAPH.topologicalSort();
+
+// evaluated during compilation
+static_assert(!GRAPH.hasCycles());
+static_assert(INIT_ORDER.size() == CAPACITY);
+static_assert(INIT_ORDER[0] == LOGGER);
+static_assert(positionOf(INIT_ORDER, DATABASE) < positionOf(INIT_ORDER, API));
+static_assert(positionOf(INIT_ORDER, CACHE) < positionOf(INIT_ORDER, API));
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing static graph", "[graph_static]")
+{
+  SECTION("When the graph is built in a constant expression, "
+          "then every head precedes its tail in the sorted keys")
+  {
+    REQUIRE(test::INIT_ORDER.size() == test::GRAPH.size());
+    REQUIRE(test::positionOf(test::INIT_ORDER, test::LOGGER)
+            < test::positionOf(test::INIT_ORDER, test::DATABASE));
+    REQUIRE(test::GRAPH.hasEdge(test::API, test::CACHE));
+    REQUIRE_FALSE(test::GRAPH.hasEdge(test::CACHE, test::API));
+  }
+
+  SECTION("When the graph has a cycle, "
+          "then the cycle is detected and the sort throws")
+  {
+    auto graph = test::makeGraph();
+    graph.addEdge(test::LOGGER, test::API);
+
+    REQUIRE(graph.hasCycles());
+    REQUIRE_THROWS_AS(graph.topologicalSort(), CircularDependencyException);
+  }
+
+  SECTION("When the graph is misused, "
+          "then an exception is thrown")
+  {
+    auto graph = test::makeGraph();
+    StaticDigraph<test::CAPACITY> smallGraph;
+    smallGraph.addNode(test::LOGGER);
+
+    REQUIRE_THROWS_AS(smallGraph.addNode(test::LOGGER), DuplicatedNodeException);
+    REQUIRE_THROWS_AS(smallGraph.addEdge(test::LOGGER, test::API), NoSuchNodeException);
+    REQUIRE_THROWS_AS(graph.addNode("extra"), std::length_error);
+  }
+
+  SECTION("When the graph is not full, "
+          "then only the added nodes are sorted")
+  {
+    StaticDigraph<test::CAPACITY> smallGraph;
+    smallGraph.addNode(test::API);
+    smallGraph.addNode(test::LOGGER);
+    smallGraph.addEdge(test::API, test::LOGGER);
+
+    auto sortedKeys = smallGraph.topologicalSort();
+    REQUIRE(sortedKeys.size() == 2);
+    REQUIRE(sortedKeys[0] == test::LOGGER);
+    REQUIRE(sortedKeys[1] == test::API);
+  }
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#define CPPPS_STATIC_PLUGINS
+
+#include "cppps/dl/Export.h"
+#include "cppps/dl/IPlugin.h"
+#include "cppps/dl/StaticPlugins.h"
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace test {
+namespace {
+
+constexpr auto STATIC_PLUGIN_NAME = "static_plugin";
+constexpr auto REGISTERED_PLUGIN_NAME = "registered_plugin";
+constexpr auto PLUGIN_VERSION = "1.0.0";
+
+class TestPlugin: public cppps::IPlugin
+{
+public:
+  explicit TestPlugin(std::string name): name{std::move(name)} {}
+  std::string getName() const override {return name;}
+  std::string getVersionString() const override {return PLUGIN_VERSION;}
+  void prepare(const cppps::ICliPtr&, cppps::IApplication&) override {}
+  void submitProviders(const cppps::SubmitProvider&) override {}
+  void submitConsumers(const cppps::SubmitConsumer&) override {}
+  void initialize() override {}
+  void start() override {}
+  void stop() override {}
+  void unload() override {}
+
+private:
+  std::string name;
+};
+
+struct StaticPlugin: TestPlugin
+{
+  StaticPlugin(): TestPlugin(STATIC_PLUGIN_NAME) {}
+};
+
+bool hasPlugin(const cppps::StaticPluginEntries& entries, const std::string& name)
+{
+  return std::any_of(entries.begin(), entries.end(), [&name](const auto& entry){
+    return entry.makePlugin()->getName() == name;
+  });
+}
+
+cppps::IPluginUPtr makeRegisteredPlugin()
+{
+  return std::make_unique<TestPlugin>(REGISTERED_PLUGIN_NAME);
+}
+
+} // namespace
+} // namespace test
+
+CPPPS_EXPORT_PLUGIN(test::StaticPlugin)
+
+TEST_CASE("Testing static plugins", "[static_plugins]")
+{
+  SECTION("When a plugin is exported in the static mode, "
+          "then it is listed in the static plugins")
+  {
+    auto plugins = cppps::getStaticPlugins();
+    REQUIRE(plugins.size() == 1);
+    REQUIRE(plugins.front().makePlugin()->getName() == test::STATIC_PLUGIN_NAME);
+  }
+
+  SECTION("When a plugin is registered at runtime, "
+          "then it is listed after the exported plugins")
+  {
+    cppps::registerStaticPlugin({&test::makeRegisteredPlugin});
+
+    auto plugins = cppps::getStaticPlugins();
+    REQUIRE(plugins.size() == 2);
+    REQUIRE(test::hasPlugin(plugins, test::STATIC_PLUGIN_NAME));
+    REQUIRE(plugins.back().makePlugin()->getName() == test::REGISTERED_PLUGIN_NAME);
+  }
+}
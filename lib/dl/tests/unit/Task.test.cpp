@@ -0,0 +1,164 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/Task.h"
+#include "cppps/dl/EpollReactor.h"
+#include <catch2/catch.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using cppps::EpollReactor;
+using cppps::IReactor;
+using cppps::ResourceRegistry;
+using cppps::Task;
+using namespace std::chrono_literals;
+
+namespace test {
+namespace {
+
+constexpr int VALUE = 42;
+constexpr auto RESOURCE_KEY = "late_resource";
+constexpr char MESSAGE = 'x';
+
+Task<int> getValue(IReactor& reactor)
+{
+  co_await cppps::sleepFor(reactor, 1ms);
+  co_return VALUE;
+}
+
+Task<int> addValues(IReactor& reactor)
+{
+  auto first = co_await getValue(reactor);
+  auto second = co_await getValue(reactor);
+  co_return first + second;
+}
+
+Task<> fail(IReactor& reactor)
+{
+  co_await cppps::sleepFor(reactor, 1ms);
+  throw std::logic_error("task error");
+}
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing coroutine tasks", "[task]")
+{
+  EpollReactor reactor;
+
+  SECTION("When tasks await other tasks, then the results are passed to the awaiting task")
+  {
+    int result = 0;
+    cppps::spawn(reactor, [](EpollReactor& reactor, int& result) -> Task<> {
+      result = co_await test::addValues(reactor);
+      reactor.stop();
+    }(reactor, result));
+
+    reactor.run();
+    REQUIRE(result == 2 * test::VALUE);
+  }
+
+  SECTION("When an awaited task throws, then the exception is passed to the error handler")
+  {
+    std::string error;
+    cppps::spawn(reactor, test::fail(reactor), [&](std::exception_ptr exception){
+      try {
+        std::rethrow_exception(exception);
+      }
+      catch (const std::logic_error& e) {
+        error = e.what();
+      }
+      reactor.stop();
+    });
+
+    reactor.run();
+    REQUIRE(error == "task error");
+  }
+
+  SECTION("When a task awaits a readable descriptor, then it resumes with the ready events")
+  {
+    int fds[2];
+    REQUIRE(pipe(fds) == 0);
+    IReactor::Events events = 0;
+    cppps::spawn(reactor, [](EpollReactor& reactor, int fd, IReactor::Events& events) -> Task<> {
+      events = co_await cppps::readable(reactor, fd);
+      reactor.stop();
+    }(reactor, fds[0], events));
+
+    std::thread writer([&](){
+      std::this_thread::sleep_for(5ms);
+      REQUIRE(write(fds[1], &test::MESSAGE, 1) == 1);
+    });
+    reactor.run();
+    writer.join();
+    close(fds[0]);
+    close(fds[1]);
+
+    REQUIRE((events & IReactor::READABLE) != 0);
+    REQUIRE_FALSE(reactor.hasSources());
+  }
+
+  SECTION("When a task awaits a resource, then it resumes once the resource is published")
+  {
+    ResourceRegistry registry;
+    int value = 0;
+    cppps::spawn(reactor, [](EpollReactor& reactor, const ResourceRegistry& registry, int& value) -> Task<> {
+      value = co_await cppps::resource<int>(reactor, registry, test::RESOURCE_KEY, 1ms);
+      reactor.stop();
+    }(reactor, registry, value));
+
+    reactor.addTimer(5ms, [&registry](){
+      registry.publish({{test::RESOURCE_KEY, cppps::Resource(test::VALUE)}});
+    });
+    reactor.run();
+
+    REQUIRE(value == test::VALUE);
+  }
+
+  SECTION("When a task running on another thread awaits a resource, then it resumes once "
+          "and leaves no polling timer behind")
+  {
+    ResourceRegistry registry;
+    int resumed = 0;
+    reactor.addTimer(5ms, [&registry](){
+      registry.publish({{test::RESOURCE_KEY, cppps::Resource(test::VALUE)}});
+    });
+    std::thread worker([&](){
+      cppps::detail::runDetached([](EpollReactor& reactor, const ResourceRegistry& registry,
+                                    int& resumed) -> Task<> {
+        co_await cppps::resource<int>(reactor, registry, test::RESOURCE_KEY, 1ms);
+        ++resumed;
+        co_await cppps::sleepFor(reactor, 5ms);
+        reactor.stop();
+      }(reactor, registry, resumed), nullptr, reactor);
+    });
+
+    reactor.run();
+    worker.join();
+    REQUIRE(resumed == 1);
+    REQUIRE_FALSE(reactor.hasSources());
+  }
+
+  SECTION("When a task running on another thread resumes on the reactor, then it continues on the reactor thread")
+  {
+    bool onReactorThread = false;
+    std::thread worker([&](){
+      cppps::detail::runDetached([](EpollReactor& reactor, bool& onReactorThread) -> Task<> {
+        co_await cppps::resumeOn(reactor);
+        onReactorThread = reactor.isReactorThread();
+        reactor.stop();
+      }(reactor, onReactorThread), nullptr, reactor);
+    });
+
+    reactor.addTimer(1h, [](){});
+    reactor.run();
+    worker.join();
+    REQUIRE(onReactorThread);
+  }
+}
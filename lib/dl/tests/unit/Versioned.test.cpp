@@ -0,0 +1,152 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/dl/Versioned.h"
+#include "cppps/dl/Resource.h"
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using cppps::EpochDomain;
+using cppps::Versioned;
+using cppps::VersionedPtr;
+
+namespace test {
+namespace {
+
+constexpr auto VALUE_A = "value A";
+constexpr auto VALUE_B = "value B";
+constexpr int READER_THREADS = 4;
+constexpr int UPDATES = 1000;
+
+// counts living instances to verify the reclamation
+struct Counted
+{
+  Counted(int value, std::atomic_int& instances)
+    : value{value}, instances{&instances} {++instances;}
+  Counted(Counted&& rhs)
+    : value{rhs.value}, instances{rhs.instances} {++(*instances);}
+  ~Counted() {--(*instances);}
+
+  int value;
+  std::atomic_int* instances;
+};
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing epoch domain", "[epoch_domain]")
+{
+  EpochDomain domain;
+  bool released = false;
+
+  SECTION("When an object is retired with no readers, then it is released on reclamation")
+  {
+    domain.retire([&released](){released = true;});
+    domain.reclaim();
+    REQUIRE(released);
+    REQUIRE(domain.getRetiredCount() == 0);
+  }
+
+  SECTION("When an object is retired during a read, then it is not released until the reader leaves")
+  {
+    {
+      auto guard = domain.enter();
+      domain.retire([&released](){released = true;});
+      domain.reclaim();
+      REQUIRE_FALSE(released);
+    }
+    domain.reclaim();
+    REQUIRE(released);
+  }
+
+  SECTION("When the domain is destroyed, then all retired objects are released")
+  {
+    {
+      EpochDomain localDomain;
+      auto guard = localDomain.enter();
+      localDomain.retire([&released](){released = true;});
+    }
+    REQUIRE(released);
+  }
+}
+
+TEST_CASE("Testing versioned resources", "[versioned]")
+{
+  auto resource = cppps::makeVersioned<std::string>(test::VALUE_A);
+
+  SECTION("When a versioned resource is created, then the initial value has version 1")
+  {
+    auto value = resource->read();
+    REQUIRE(*value == test::VALUE_A);
+    REQUIRE(value.getVersion() == 1);
+  }
+
+  SECTION("When a new value is published, then the readers get the new version")
+  {
+    auto version = resource->publish(test::VALUE_B);
+    auto value = resource->read();
+    REQUIRE(*value == test::VALUE_B);
+    REQUIRE(value.getVersion() == version);
+    REQUIRE(resource->getVersion() == 2);
+  }
+
+  SECTION("When a new value is published during a read, then the pinned version remains unchanged")
+  {
+    auto value = resource->read();
+    resource->publish(test::VALUE_B);
+    REQUIRE(*value == test::VALUE_A);
+    REQUIRE(value.getVersion() == 1);
+  }
+
+  SECTION("When a versioned resource is shared as a resource, then it can be consumed")
+  {
+    cppps::Resource shared {std::move(resource)};
+    auto consumed = shared.as<VersionedPtr<std::string>>();
+    REQUIRE(*consumed->read() == test::VALUE_A);
+  }
+}
+
+TEST_CASE("Testing versioned resources concurrency", "[versioned_mt]")
+{
+  std::atomic_int instances {0};
+
+  {
+    Versioned<test::Counted> resource(0, instances);
+    std::atomic_bool done {false};
+    std::atomic_int failures {0};
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < test::READER_THREADS; ++i) {
+      readers.emplace_back([&resource, &done, &failures](){
+        int lastValue = 0;
+        while (!done) {
+          auto value = resource.read();
+          if (value->value < lastValue) {
+            ++failures;
+          }
+          lastValue = value->value;
+        }
+      });
+    }
+
+    for (int i = 1; i <= test::UPDATES; ++i) {
+      resource.publish(test::Counted(i, instances));
+    }
+    done = true;
+
+    for (auto& reader: readers) {
+      reader.join();
+    }
+    resource.reclaim();
+
+    REQUIRE(failures == 0);
+    REQUIRE(resource.read()->value == test::UPDATES);
+  }
+
+  REQUIRE(instances == 0);
+}
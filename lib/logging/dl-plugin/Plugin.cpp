@@ -4,6 +4,7 @@
 
 #include "Plugin.h"
 
+#include <cppps/dl/IApplication.h>
 #include <cppps/dl/ICli.h>
 #include <cppps/dl/Export.h>
 #include <cppps/logging/Logging.h>
@@ -13,9 +14,10 @@
 
 using namespace cppps;
 
-void Plugin::prepare(const ICliPtr& cli, IApplication&)
+void Plugin::prepare(const ICliPtr& cli, IApplication& app)
 {
   cppps::setupLoggingCli(*cli, loggerSettings);
+  app.addOnExitFlushHook(cppps::flushLogs);
 };
 
 void Plugin::submitProviders(const SubmitProvider& submitProvider)
@@ -14,7 +14,7 @@ public:
   std::string getName() const override {return PLUGIN_NAME;}
   std::string getVersionString() const override {return PLUGIN_VERSION;}
 
-  void prepare(const cppps::ICliPtr& cli, cppps::IApplication&) override;
+  void prepare(const cppps::ICliPtr& cli, cppps::IApplication& app) override;
 
   void submitProviders(const cppps::SubmitProvider& submitProvider) override;
   void submitConsumers(const cppps::SubmitConsumer& /*submitConsumer*/) override {};
@@ -6,6 +6,7 @@
 #define PLUGIN_H
 
 #include <cppps/dl/IPlugin.h>
+#include <cppps/dl/IApplication.h>
 #include <cppps/dl/ICli.h>
 
 #include <cppps/logging/Logging.h>
@@ -21,8 +22,9 @@ public:
   std::string getName() const override {return PLUGIN_NAME;}
   std::string getVersionString() const override {return PLUGIN_VERSION;}
 
-  void prepare(const cppps::ICliPtr& cli, cppps::IApplication&) override {
+  void prepare(const cppps::ICliPtr& cli, cppps::IApplication& app) override {
     cppps::setupLoggingCli(*cli, loggerSettings);
+    app.addOnExitFlushHook(cppps::flushLogs);
   }
 
   void submitProviders(const cppps::SubmitProvider& submitProvider) override {
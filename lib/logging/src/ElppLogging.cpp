@@ -93,6 +93,13 @@ void cppps::importLogger(const LoggerPtr& logger)
   el::Helpers::setStorage(logger->getStorage());
 }
 
+void cppps::flushLogs()
+{
+  if (el::Helpers::storage()) {
+    el::Loggers::flushAll();
+  }
+}
+
 
 // ---------
 
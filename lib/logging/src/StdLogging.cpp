@@ -21,3 +21,8 @@ void cppps::importLogger(const LoggerPtr&)
 {
   // empty
 }
+
+void cppps::flushLogs()
+{
+  // empty
+}
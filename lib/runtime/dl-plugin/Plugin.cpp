@@ -0,0 +1,16 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include <cppps/runtime/Plugin.h>
+#include <cppps/dl/Export.h>
+
+#include <string_view>
+
+#ifdef PLUGIN_PROVIDES
+static_assert(std::string_view(PLUGIN_PROVIDES)
+              == CPPPS_RUNTIME_EXECUTOR_NAME "," CPPPS_RUNTIME_TIMERS_NAME,
+              "PLUGIN_PROVIDES has to list the submitted resource keys");
+#endif
+
+CPPPS_EXPORT_PLUGIN(Plugin)
@@ -0,0 +1,190 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef IEXECUTOR_H
+#define IEXECUTOR_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace cppps {
+
+enum class TaskPriority {HIGH = 0, NORMAL, LOW};
+
+constexpr size_t TASK_PRIORITIES = 3;
+
+struct TaskStats
+{
+  std::string owner;
+  uint64_t submitted {0};
+  uint64_t completed {0};
+  uint64_t failed {0};
+  std::chrono::nanoseconds busyTime {0};
+};
+
+/**
+ * @brief Task counters of a single executor client (e.g. a plugin).
+ */
+class TaskAccount
+{
+public:
+  explicit TaskAccount(std::string_view owner): owner{owner} {}
+
+  void onSubmitted() {submitted.fetch_add(1, std::memory_order_relaxed);}
+  void onFinished(std::chrono::nanoseconds duration, bool success);
+  [[nodiscard]] TaskStats getStats() const;
+
+private:
+  const std::string owner;
+  std::atomic<uint64_t> submitted {0};
+  std::atomic<uint64_t> completed {0};
+  std::atomic<uint64_t> failed {0};
+  std::atomic<int64_t> busyTimeNs {0};
+};
+
+using TaskAccountPtr = std::shared_ptr<TaskAccount>;
+
+/**
+ * @brief Executor interface shared between the plugins.
+ *
+ * Tasks are posted with a priority and an optional
+ * account used to track the tasks of a given client.
+ */
+class IExecutor
+{
+public:
+  using Task = std::function<void()>;
+  using Stats = std::list<TaskStats>;
+
+  virtual ~IExecutor() = default;
+
+  /**
+   * @brief Schedule a task for execution
+   * @param task Task to be executed
+   * @param priority Task priority
+   * @param account Task account (see getAccount), may be null
+   */
+  virtual void post(Task task, TaskPriority priority, const TaskAccountPtr& account) = 0;
+
+  /**
+   * @brief Get the task account of given owner, creating it if needed
+   * @param owner Name of the task owner, e.g. the plugin name
+   */
+  virtual TaskAccountPtr getAccount(std::string_view owner) = 0;
+
+  /**
+   * @brief Get the number of worker threads
+   */
+  virtual size_t getConcurrency() const = 0;
+
+  /**
+   * @brief Get the statistics of all task accounts
+   */
+  virtual Stats getStats() const = 0;
+
+  /**
+   * @brief Schedule a function and get its result asynchronously
+   * @param function Function to be executed
+   * @param priority Task priority
+   * @param account Task account, may be null
+   * @return Future of the function result
+   */
+  template <class F>
+  auto submit(F&& function, TaskPriority priority = TaskPriority::NORMAL,
+              const TaskAccountPtr& account = nullptr)
+  -> std::future<std::invoke_result_t<std::decay_t<F>>>;
+};
+
+using IExecutorPtr = std::shared_ptr<IExecutor>;
+
+/**
+ * @brief Executor handle bound to the task account of its owner.
+ *
+ * Example consumer:
+ * @code
+ * submitConsumer(CPPPS_RUNTIME_EXECUTOR_NAME, [this](const Resource& resource){
+ *   executor = ExecutorClient(resource.as<IExecutorPtr>(), getName());
+ * });
+ * // ...
+ * auto result = executor.submit([](){return compute();});
+ * @endcode
+ */
+class ExecutorClient
+{
+public:
+  ExecutorClient() = default;
+  ExecutorClient(const IExecutorPtr& executor, std::string_view owner)
+    : executor{executor}, account{executor->getAccount(owner)} {}
+
+  void post(IExecutor::Task task, TaskPriority priority = TaskPriority::NORMAL)
+  {
+    executor->post(std::move(task), priority, account);
+  }
+
+  template <class F>
+  auto submit(F&& function, TaskPriority priority = TaskPriority::NORMAL)
+  {
+    return executor->submit(std::forward<F>(function), priority, account);
+  }
+
+  [[nodiscard]] TaskStats getStats() const {return account->getStats();}
+  [[nodiscard]] const IExecutorPtr& getExecutor() const {return executor;}
+
+private:
+  IExecutorPtr executor {nullptr};
+  TaskAccountPtr account {nullptr};
+};
+
+// ----------
+
+inline void TaskAccount::onFinished(std::chrono::nanoseconds duration, bool success)
+{
+  (success ? completed : failed).fetch_add(1, std::memory_order_relaxed);
+  busyTimeNs.fetch_add(duration.count(), std::memory_order_relaxed);
+}
+
+inline TaskStats TaskAccount::getStats() const
+{
+  return {owner, submitted.load(), completed.load(), failed.load(),
+          std::chrono::nanoseconds(busyTimeNs.load())};
+}
+
+template <class F>
+auto IExecutor::submit(F&& function, TaskPriority priority, const TaskAccountPtr& account)
+-> std::future<std::invoke_result_t<std::decay_t<F>>>
+{
+  using Result = std::invoke_result_t<std::decay_t<F>>;
+  auto callable = std::make_shared<std::decay_t<F>>(std::forward<F>(function));
+  auto promise = std::make_shared<std::promise<Result>>();
+  auto future = promise->get_future();
+  post([callable, promise](){
+    try {
+      if constexpr (std::is_void_v<Result>) {
+        (*callable)();
+        promise->set_value();
+      }
+      else {
+        promise->set_value((*callable)());
+      }
+    }
+    catch (...) {
+      // passed through the future and accounted as a failed task
+      promise->set_exception(std::current_exception());
+      throw;
+    }
+  }, priority, account);
+  return future;
+}
+
+} // namespace cppps
+
+#endif // IEXECUTOR_H
@@ -0,0 +1,127 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef ITIMERSERVICE_H
+#define ITIMERSERVICE_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace cppps {
+
+/**
+ * @brief Timer service interface shared between the plugins.
+ *
+ * Every timer belongs to an owner (e.g. a plugin name), so all
+ * the timers of a given owner can be cancelled at once. Once
+ * cancel() returns, the callback of the cancelled timer is not
+ * going to be started (but a callback running at the moment
+ * of cancellation is not interrupted).
+ */
+class ITimerService
+{
+public:
+  using TimerId = uint64_t;
+  using Callback = std::function<void()>;
+  using Clock = std::chrono::steady_clock;
+  using Duration = std::chrono::nanoseconds;
+
+  static constexpr TimerId INVALID_TIMER = 0;
+
+  virtual ~ITimerService() = default;
+
+  /**
+   * @brief Schedule a one-shot timer
+   * @param delay Time after which the callback is called
+   * @param callback Timer callback
+   * @param owner Name of the timer owner
+   * @return Timer identifier, INVALID_TIMER if the service has been shut down
+   */
+  virtual TimerId schedule(Duration delay, Callback callback, std::string_view owner) = 0;
+
+  /**
+   * @brief Schedule a periodic timer
+   * @param period Timer period, the first call takes place after one period
+   * @param callback Timer callback
+   * @param owner Name of the timer owner
+   * @return Timer identifier, INVALID_TIMER if the service has been shut down
+   */
+  virtual TimerId schedulePeriodic(Duration period, Callback callback, std::string_view owner) = 0;
+
+  /**
+   * @brief Cancel a timer
+   * @return false if the timer has already expired or has been cancelled
+   */
+  virtual bool cancel(TimerId id) = 0;
+
+  /**
+   * @brief Cancel all timers of given owner
+   * @return Number of cancelled timers
+   */
+  virtual size_t cancelOwner(std::string_view owner) = 0;
+
+  /**
+   * @brief Get the number of active timers
+   */
+  virtual size_t getTimerCount() const = 0;
+
+  /**
+   * @brief Get the timer resolution (the wheel tick)
+   */
+  virtual Duration getResolution() const = 0;
+};
+
+using ITimerServicePtr = std::shared_ptr<ITimerService>;
+
+/**
+ * @brief Timer service handle bound to its owner.
+ *
+ * The timers of the plugin passed as the owner are cancelled
+ * by the service automatically when the plugin is stopped.
+ *
+ * Example consumer:
+ * @code
+ * submitConsumer(CPPPS_RUNTIME_TIMERS_NAME, [this](const Resource& resource){
+ *   timers = TimerClient(resource.as<ITimerServicePtr>(), getName());
+ * });
+ * // ...
+ * timers.schedulePeriodic(std::chrono::seconds(1), [this](){poll();});
+ * @endcode
+ */
+class TimerClient
+{
+public:
+  using TimerId = ITimerService::TimerId;
+
+  TimerClient() = default;
+  TimerClient(const ITimerServicePtr& service, std::string_view owner)
+    : service{service}, owner{owner} {}
+
+  TimerId schedule(ITimerService::Duration delay, ITimerService::Callback callback)
+  {
+    return service->schedule(delay, std::move(callback), owner);
+  }
+
+  TimerId schedulePeriodic(ITimerService::Duration period, ITimerService::Callback callback)
+  {
+    return service->schedulePeriodic(period, std::move(callback), owner);
+  }
+
+  bool cancel(TimerId id) {return service->cancel(id);}
+  size_t cancelAll() {return service->cancelOwner(owner);}
+
+  [[nodiscard]] const ITimerServicePtr& getService() const {return service;}
+
+private:
+  ITimerServicePtr service {nullptr};
+  std::string owner;
+};
+
+} // namespace cppps
+
+#endif // ITIMERSERVICE_H
@@ -0,0 +1,80 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef PLUGIN_H
+#define PLUGIN_H
+
+#include <cppps/dl/IPlugin.h>
+#include <cppps/dl/ICli.h>
+#include <cppps/dl/IApplication.h>
+
+#include <cppps/runtime/RuntimeCli.h>
+#include <cppps/runtime/TimerWheel.h>
+#include <cppps/runtime/WorkStealingExecutor.h>
+
+#ifndef CPPPS_RUNTIME_EXECUTOR_NAME
+#  define CPPPS_RUNTIME_EXECUTOR_NAME "shared_executor"
+#endif
+
+#ifndef CPPPS_RUNTIME_TIMERS_NAME
+#  define CPPPS_RUNTIME_TIMERS_NAME "shared_timers"
+#endif
+
+class Plugin: public cppps::IPlugin
+{
+public:
+  std::string getName() const override {return PLUGIN_NAME;}
+  std::string getVersionString() const override {return PLUGIN_VERSION;}
+
+  void prepare(const cppps::ICliPtr& cli, cppps::IApplication& app) override {
+    cppps::setupRuntimeCli(*cli, settings);
+    application = &app;
+    pluginStoppedHookId = app.addOnPluginStoppedHook([this](const std::string& pluginName){
+      if (timers) {
+        timers->cancelOwner(pluginName);
+      }
+    });
+  }
+
+  void submitProviders(const cppps::SubmitProvider& submitProvider) override {
+    submitProvider(CPPPS_RUNTIME_EXECUTOR_NAME, [this](){
+      return std::static_pointer_cast<cppps::IExecutor>(executor);
+    });
+    submitProvider(CPPPS_RUNTIME_TIMERS_NAME, [this](){
+      return std::static_pointer_cast<cppps::ITimerService>(timers);
+    });
+  }
+
+  void submitConsumers(const cppps::SubmitConsumer& /*submitConsumer*/) override {};
+
+  void initialize() override {
+    executor = std::make_shared<cppps::WorkStealingExecutor>(settings.executorThreads);
+    timers = std::make_shared<cppps::TimerWheel>(
+          executor, std::chrono::microseconds(settings.timerResolutionUs));
+  }
+
+  void start() override {};
+
+  void stop() override {
+    // consumers are stopped first, drain their pending tasks
+    timers->shutdown();
+    executor->shutdown();
+  };
+
+  void unload() override {
+    // a reloaded instance registers its own hook
+    if (application) {
+      application->removeOnPluginStoppedHook(pluginStoppedHookId);
+    }
+  }
+
+private:
+  cppps::IApplication* application {nullptr};
+  cppps::IApplication::HookId pluginStoppedHookId {0};
+  std::shared_ptr<cppps::WorkStealingExecutor> executor {nullptr};
+  std::shared_ptr<cppps::TimerWheel> timers {nullptr};
+  cppps::RuntimeSettings settings;
+};
+
+#endif // PLUGIN_H
@@ -0,0 +1,21 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef RUNTIMECLI_H
+#define RUNTIMECLI_H
+
+#include "cppps/runtime/RuntimeSettings.h"
+
+namespace cppps {
+
+template <class T>
+void setupRuntimeCli(T& cli, RuntimeSettings& settings)
+{
+  cli.addOption("--executor-threads", settings.executorThreads, "Number of executor threads, 0 for all CPUs");
+  cli.addOption("--timer-resolution-us", settings.timerResolutionUs, "Shared timer wheel tick in microseconds");
+}
+
+} // namespace cppps
+
+#endif // RUNTIMECLI_H
@@ -0,0 +1,19 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef RUNTIMESETTINGS_H
+#define RUNTIMESETTINGS_H
+
+#include <cstdint>
+
+namespace cppps {
+
+struct RuntimeSettings {
+  uintmax_t executorThreads {0}; // all available CPUs
+  uintmax_t timerResolutionUs {1000};
+};
+
+} // namespace cppps
+
+#endif // RUNTIMESETTINGS_H
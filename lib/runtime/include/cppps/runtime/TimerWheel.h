@@ -0,0 +1,138 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include "cppps/runtime/ITimerService.h"
+#include "cppps/runtime/IExecutor.h"
+
+#include <array>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cppps {
+
+/**
+ * @brief Hierarchical timing wheel driven by a single thread.
+ *
+ * Four levels of 256 slots cover 2^32 ticks; the timers
+ * are kept in intrusive lists of a node pool, so scheduling
+ * and cancelling are O(1). Timers of the upper levels are
+ * cascaded to the lower ones as the time advances. Timers
+ * exceeding the wheel range are re-cascaded from the top level.
+ *
+ * Expired callbacks are posted to the executor with the task
+ * account of the timer owner, or called directly on the wheel
+ * thread when no executor is given.
+ */
+class TimerWheel: public ITimerService
+{
+public:
+  static constexpr auto DEFAULT_RESOLUTION = std::chrono::milliseconds(1);
+
+  /**
+   * @param executor Executor running the callbacks, may be null
+   * @param resolution Duration of a single tick
+   */
+  explicit TimerWheel(const IExecutorPtr& executor = nullptr,
+                      Duration resolution = DEFAULT_RESOLUTION);
+  ~TimerWheel() override;
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  /**
+   * @brief Stop the wheel thread and drop all timers
+   */
+  void shutdown();
+
+  // ITimerService
+  TimerId schedule(Duration delay, Callback callback, std::string_view owner) override;
+  TimerId schedulePeriodic(Duration period, Callback callback, std::string_view owner) override;
+  bool cancel(TimerId id) override;
+  size_t cancelOwner(std::string_view owner) override;
+  size_t getTimerCount() const override;
+  Duration getResolution() const override;
+
+private:
+  static constexpr size_t LEVELS = 4;
+  static constexpr size_t SLOT_BITS = 8;
+  static constexpr size_t SLOTS = 1u << SLOT_BITS;
+  static constexpr uint32_t NIL = UINT32_MAX;
+
+  enum class State: uint8_t {FREE, SCHEDULED, EXPIRED};
+
+  struct Node
+  {
+    uint64_t expires {0};
+    uint64_t period {0};
+    std::shared_ptr<Callback> callback;
+    uint32_t generation {1};
+    uint32_t slot {NIL};
+    uint32_t prev {NIL};
+    uint32_t next {NIL};
+    uint32_t owner {NIL};
+    uint32_t ownerPrev {NIL};
+    uint32_t ownerNext {NIL};
+    State state {State::FREE};
+  };
+
+  struct Owner
+  {
+    std::string name;
+    TaskAccountPtr account;
+    uint32_t head {NIL};
+  };
+
+  struct Expired
+  {
+    TimerId id;
+    std::shared_ptr<Callback> callback;
+    TaskAccountPtr account;
+  };
+
+  const IExecutorPtr executor;
+  const Duration resolution;
+  const Clock::time_point origin;
+
+  std::vector<Node> nodes;
+  uint32_t freeHead {NIL};
+  std::array<uint32_t, LEVELS * SLOTS> slots;
+  uint64_t currentTick {0};
+  size_t timerCount {0};
+
+  std::vector<Owner> owners;
+  std::map<std::string, uint32_t, std::less<>> ownerIndices;
+
+  mutable std::mutex mutex;
+  std::condition_variable wakeUp;
+  uint64_t wakeUpTick {UINT64_MAX};
+  bool stopping {false};
+  std::thread thread;
+
+private:
+  TimerId add(Duration delay, Duration period, Callback&& callback, std::string_view owner);
+  uint32_t allocateNode();
+  void releaseNode(uint32_t index);
+  uint32_t getOwner(std::string_view name);
+  void link(uint32_t index);
+  void unlink(uint32_t index);
+  void cascade(size_t level);
+  void advance(uint64_t targetTick, std::vector<Expired>& expired);
+  uint64_t getNextEventTick() const;
+  uint64_t getElapsedTicks() const;
+  void dispatch(std::vector<Expired>& expired);
+  bool claim(TimerId id);
+  void run();
+};
+
+using TimerWheelPtr = std::shared_ptr<TimerWheel>;
+
+} // namespace cppps
+
+#endif // TIMERWHEEL_H
@@ -0,0 +1,82 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#ifndef WORKSTEALINGEXECUTOR_H
+#define WORKSTEALINGEXECUTOR_H
+
+#include "cppps/runtime/IExecutor.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace cppps {
+
+class ExecutorShutdownException: public std::runtime_error {
+  using runtime_error::runtime_error;
+};
+
+/**
+ * @brief Thread pool with per-worker task queues.
+ *
+ * Every worker owns a queue for each priority level. Tasks
+ * posted by a worker go to its own queue, tasks posted from
+ * other threads are distributed round-robin. Idle workers steal
+ * tasks from the other queues, always trying the higher
+ * priorities first. Pending tasks are drained on shutdown.
+ */
+class WorkStealingExecutor: public IExecutor
+{
+public:
+
+  /**
+   * @param threads Number of worker threads, 0 to use all available CPUs
+   */
+  explicit WorkStealingExecutor(size_t threads = 0);
+  ~WorkStealingExecutor() override;
+
+  /**
+   * @brief Execute the pending tasks and join the workers.
+   *
+   * Posting tasks after the shutdown results in throwing
+   * the ExecutorShutdownException. Called from a task, it does not
+   * wait for the calling worker, which is joined by the destructor
+   * (or detached, when the executor is destroyed by its own task).
+   */
+  void shutdown();
+
+  // IExecutor
+  void post(Task task, TaskPriority priority, const TaskAccountPtr& account) override;
+  TaskAccountPtr getAccount(std::string_view owner) override;
+  size_t getConcurrency() const override;
+  Stats getStats() const override;
+
+private:
+  struct Worker;
+  struct Item;
+
+  std::vector<std::unique_ptr<Worker>> workers;
+  std::atomic<size_t> nextWorker {0};
+  std::atomic<size_t> pendingTasks {0};
+  std::atomic_bool stopping {false};
+
+  std::mutex sleepMutex;
+  std::condition_variable wakeUp;
+
+  TaskAccountPtr defaultAccount;
+  std::map<std::string, TaskAccountPtr, std::less<>> accounts;
+  mutable std::mutex accountsMutex;
+
+private:
+  void run(size_t index);
+  bool tryPop(size_t index, Item& item);
+  void execute(Item& item);
+};
+
+} // namespace cppps
+
+#endif // WORKSTEALINGEXECUTOR_H
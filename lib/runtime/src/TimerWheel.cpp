@@ -0,0 +1,394 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/runtime/TimerWheel.h"
+
+#include <algorithm>
+
+using cppps::TimerWheel;
+
+namespace {
+
+constexpr uint64_t INDEX_MASK = 0xffffffffu;
+constexpr int GENERATION_SHIFT = 32;
+constexpr uint64_t NO_WAKE_UP = UINT64_MAX;
+
+uint64_t toTicks(std::chrono::nanoseconds duration, std::chrono::nanoseconds resolution)
+{
+  auto count = std::max<int64_t>(duration.count(), 0);
+  return static_cast<uint64_t>((count + resolution.count() - 1) / resolution.count());
+}
+
+} // namespace
+
+TimerWheel::TimerWheel(const IExecutorPtr& executor, Duration resolution)
+  : executor{executor},
+    resolution{std::max(resolution, Duration(1))},
+    origin{Clock::now()}
+{
+  slots.fill(NIL);
+  thread = std::thread([this](){run();});
+}
+
+TimerWheel::~TimerWheel()
+{
+  shutdown();
+}
+
+void TimerWheel::shutdown()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  wakeUp.notify_all();
+
+  if (thread.joinable() && thread.get_id() != std::this_thread::get_id()) {
+    thread.join();
+  }
+
+  // callbacks are destroyed outside the lock
+  std::vector<Node> droppedNodes;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    droppedNodes.swap(nodes);
+    slots.fill(NIL);
+    freeHead = NIL;
+    timerCount = 0;
+    for (auto& owner: owners) {
+      owner.head = NIL;
+    }
+  }
+}
+
+TimerWheel::TimerId TimerWheel::schedule(Duration delay, Callback callback, std::string_view owner)
+{
+  return add(delay, Duration(0), std::move(callback), owner);
+}
+
+TimerWheel::TimerId TimerWheel::schedulePeriodic(Duration period, Callback callback, std::string_view owner)
+{
+  return add(period, std::max(period, resolution), std::move(callback), owner);
+}
+
+bool TimerWheel::cancel(TimerId id)
+{
+  std::shared_ptr<Callback> callback;
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto index = static_cast<uint32_t>(id & INDEX_MASK);
+  if (index >= nodes.size()
+      || nodes[index].generation != (id >> GENERATION_SHIFT)
+      || nodes[index].state == State::FREE) {
+    return false;
+  }
+
+  callback = std::move(nodes[index].callback);
+  releaseNode(index);
+  return true;
+}
+
+size_t TimerWheel::cancelOwner(std::string_view owner)
+{
+  std::vector<std::shared_ptr<Callback>> callbacks;
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto it = ownerIndices.find(owner);
+  if (it == ownerIndices.end()) {
+    return 0;
+  }
+
+  auto& ownerEntry = owners[it->second];
+  while (ownerEntry.head != NIL) {
+    auto index = ownerEntry.head;
+    callbacks.push_back(std::move(nodes[index].callback));
+    releaseNode(index);
+  }
+  return callbacks.size();
+}
+
+size_t TimerWheel::getTimerCount() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return timerCount;
+}
+
+TimerWheel::Duration TimerWheel::getResolution() const
+{
+  return resolution;
+}
+
+TimerWheel::TimerId TimerWheel::add(Duration delay, Duration period, Callback&& callback,
+                                    std::string_view owner)
+{
+  auto sharedCallback = std::make_shared<Callback>(std::move(callback));
+  std::lock_guard<std::mutex> lock(mutex);
+  if (stopping) {
+    return INVALID_TIMER;
+  }
+
+  if (timerCount == 0) {
+    // skip the idle period instead of replaying it tick by tick
+    currentTick = std::max(currentTick, getElapsedTicks());
+  }
+
+  auto index = allocateNode();
+  auto& node = nodes[index];
+  node.expires = toTicks(Clock::now() - origin + delay, resolution);
+  node.period = toTicks(period, resolution);
+  node.callback = std::move(sharedCallback);
+  node.state = State::SCHEDULED;
+
+  node.owner = getOwner(owner);
+  auto& ownerEntry = owners[node.owner];
+  node.ownerNext = ownerEntry.head;
+  if (ownerEntry.head != NIL) {
+    nodes[ownerEntry.head].ownerPrev = index;
+  }
+  ownerEntry.head = index;
+
+  link(index);
+  ++timerCount;
+
+  if (node.expires < wakeUpTick) {
+    wakeUp.notify_one();
+  }
+
+  return (static_cast<TimerId>(node.generation) << GENERATION_SHIFT) | index;
+}
+
+uint32_t TimerWheel::allocateNode()
+{
+  if (freeHead == NIL) {
+    nodes.emplace_back();
+    return static_cast<uint32_t>(nodes.size() - 1);
+  }
+
+  auto index = freeHead;
+  freeHead = nodes[index].next;
+  nodes[index].next = NIL;
+  return index;
+}
+
+void TimerWheel::releaseNode(uint32_t index)
+{
+  auto& node = nodes[index];
+  if (node.state == State::SCHEDULED) {
+    unlink(index);
+    --timerCount;
+  }
+
+  if (node.ownerPrev != NIL) {
+    nodes[node.ownerPrev].ownerNext = node.ownerNext;
+  }
+  else {
+    owners[node.owner].head = node.ownerNext;
+  }
+  if (node.ownerNext != NIL) {
+    nodes[node.ownerNext].ownerPrev = node.ownerPrev;
+  }
+
+  auto generation = node.generation + 1;
+  node = Node{};
+  node.generation = generation;
+  node.next = freeHead;
+  freeHead = index;
+}
+
+uint32_t TimerWheel::getOwner(std::string_view name)
+{
+  auto it = ownerIndices.find(name);
+  if (it != ownerIndices.end()) {
+    return it->second;
+  }
+
+  auto index = static_cast<uint32_t>(owners.size());
+  owners.push_back({std::string(name), executor ? executor->getAccount(name) : nullptr, NIL});
+  ownerIndices.emplace(name, index);
+  return index;
+}
+
+void TimerWheel::link(uint32_t index)
+{
+  auto& node = nodes[index];
+  auto expires = std::max(node.expires, currentTick);
+  auto delta = expires - currentTick;
+
+  size_t level = 0;
+  while (level < LEVELS - 1 && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1)))) {
+    ++level;
+  }
+  if (level == LEVELS - 1 && delta >= (uint64_t(1) << (SLOT_BITS * LEVELS))) {
+    // out of the wheel range, cascaded again from the top level
+    expires = currentTick + (uint64_t(1) << (SLOT_BITS * LEVELS)) - 1;
+  }
+
+  auto slot = static_cast<uint32_t>(level * SLOTS + ((expires >> (SLOT_BITS * level)) & (SLOTS - 1)));
+  node.slot = slot;
+  node.prev = NIL;
+  node.next = slots[slot];
+  if (node.next != NIL) {
+    nodes[node.next].prev = index;
+  }
+  slots[slot] = index;
+}
+
+void TimerWheel::unlink(uint32_t index)
+{
+  auto& node = nodes[index];
+  if (node.prev != NIL) {
+    nodes[node.prev].next = node.next;
+  }
+  else {
+    slots[node.slot] = node.next;
+  }
+  if (node.next != NIL) {
+    nodes[node.next].prev = node.prev;
+  }
+  node.prev = NIL;
+  node.next = NIL;
+  node.slot = NIL;
+}
+
+void TimerWheel::cascade(size_t level)
+{
+  auto slot = level * SLOTS + ((currentTick >> (SLOT_BITS * level)) & (SLOTS - 1));
+  auto index = slots[slot];
+  slots[slot] = NIL;
+
+  while (index != NIL) {
+    auto next = nodes[index].next;
+    link(index);
+    index = next;
+  }
+}
+
+void TimerWheel::advance(uint64_t targetTick, std::vector<Expired>& expired)
+{
+  while (currentTick <= targetTick && timerCount > 0) {
+    auto slotIndex = currentTick & (SLOTS - 1);
+    for (size_t level = 1; level < LEVELS && slotIndex == 0; ++level) {
+      cascade(level);
+      slotIndex = (currentTick >> (SLOT_BITS * level)) & (SLOTS - 1);
+    }
+
+    auto& slot = slots[currentTick & (SLOTS - 1)];
+    while (slot != NIL) {
+      auto index = slot;
+      unlink(index);
+
+      auto& node = nodes[index];
+      auto id = (static_cast<TimerId>(node.generation) << GENERATION_SHIFT) | index;
+      expired.push_back({id, node.callback, owners[node.owner].account});
+
+      if (node.period > 0) {
+        node.expires = std::max(node.expires + node.period, currentTick + 1);
+        link(index);
+      }
+      else {
+        // released when claimed by the callback task or cancelled
+        node.state = State::EXPIRED;
+        --timerCount;
+      }
+    }
+
+    ++currentTick;
+  }
+
+  if (timerCount == 0) {
+    currentTick = std::max(currentTick, targetTick + 1);
+  }
+}
+
+uint64_t TimerWheel::getNextEventTick() const
+{
+  if (timerCount == 0) {
+    return NO_WAKE_UP;
+  }
+
+  auto tick = currentTick;
+  while ((tick & (SLOTS - 1)) != 0 && slots[tick & (SLOTS - 1)] == NIL) {
+    ++tick;
+  }
+  // the first expiring slot or the next cascade
+  return tick;
+}
+
+uint64_t TimerWheel::getElapsedTicks() const
+{
+  return static_cast<uint64_t>((Clock::now() - origin) / resolution);
+}
+
+void TimerWheel::dispatch(std::vector<Expired>& expired)
+{
+  for (auto& [id, callback, account]: expired) {
+    auto task = [this, id = id, callback = std::move(callback)](){
+      if (claim(id)) {
+        (*callback)();
+      }
+    };
+
+    if (!executor) {
+      try {
+        task();
+      }
+      catch (...) {
+        // the wheel thread must survive failing callbacks
+      }
+      continue;
+    }
+
+    try {
+      executor->post(std::move(task), TaskPriority::NORMAL, account);
+    }
+    catch (const std::exception&) {
+      // the executor has been shut down, drop the callback
+    }
+  }
+  expired.clear();
+}
+
+bool TimerWheel::claim(TimerId id)
+{
+  std::shared_ptr<Callback> callback;
+  std::lock_guard<std::mutex> lock(mutex);
+
+  auto index = static_cast<uint32_t>(id & INDEX_MASK);
+  if (index >= nodes.size() || nodes[index].generation != (id >> GENERATION_SHIFT)) {
+    return false;
+  }
+
+  auto& node = nodes[index];
+  if (node.state == State::EXPIRED) {
+    callback = std::move(node.callback);
+    releaseNode(index);
+    return true;
+  }
+  return node.state == State::SCHEDULED;
+}
+
+void TimerWheel::run()
+{
+  std::vector<Expired> expired;
+  std::unique_lock<std::mutex> lock(mutex);
+
+  while (!stopping) {
+    advance(getElapsedTicks(), expired);
+    if (!expired.empty()) {
+      lock.unlock();
+      dispatch(expired);
+      lock.lock();
+      continue;
+    }
+
+    wakeUpTick = getNextEventTick();
+    if (wakeUpTick == NO_WAKE_UP) {
+      wakeUp.wait(lock);
+    }
+    else {
+      wakeUp.wait_until(lock, origin + resolution * static_cast<int64_t>(wakeUpTick));
+    }
+    wakeUpTick = NO_WAKE_UP;
+  }
+}
@@ -0,0 +1,208 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/runtime/WorkStealingExecutor.h"
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <thread>
+
+using cppps::WorkStealingExecutor;
+using cppps::TaskAccountPtr;
+
+namespace {
+
+constexpr size_t CACHE_LINE_SIZE = 64;
+constexpr auto DEFAULT_ACCOUNT_NAME = "";
+
+// worker identity of the calling thread
+thread_local const WorkStealingExecutor* currentExecutor {nullptr};
+thread_local size_t currentWorker {0};
+
+} // namespace
+
+struct WorkStealingExecutor::Item
+{
+  Task task;
+  TaskAccountPtr account;
+};
+
+struct alignas(CACHE_LINE_SIZE) WorkStealingExecutor::Worker
+{
+  std::mutex mutex;
+  std::array<std::deque<Item>, TASK_PRIORITIES> queues;
+  std::thread thread;
+};
+
+WorkStealingExecutor::WorkStealingExecutor(size_t threads)
+  : defaultAccount{std::make_shared<TaskAccount>(DEFAULT_ACCOUNT_NAME)}
+{
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  accounts.emplace(DEFAULT_ACCOUNT_NAME, defaultAccount);
+
+  for (size_t i = 0; i < threads; ++i) {
+    workers.push_back(std::make_unique<Worker>());
+  }
+
+  for (size_t i = 0; i < threads; ++i) {
+    workers[i]->thread = std::thread([this, i](){run(i);});
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor()
+{
+  shutdown();
+
+  // destroyed by a task, the calling worker cannot join itself
+  for (auto& worker: workers) {
+    if (worker->thread.joinable()) {
+      worker->thread.detach();
+      currentExecutor = nullptr;
+    }
+  }
+}
+
+void WorkStealingExecutor::shutdown()
+{
+  {
+    std::lock_guard<std::mutex> lock(sleepMutex);
+    stopping = true;
+  }
+  wakeUp.notify_all();
+
+  for (auto& worker: workers) {
+    if (worker->thread.joinable() && worker->thread.get_id() != std::this_thread::get_id()) {
+      worker->thread.join();
+    }
+  }
+}
+
+void WorkStealingExecutor::post(Task task, TaskPriority priority, const TaskAccountPtr& account)
+{
+  {
+    // keeps the workers alive until the task is executed
+    std::lock_guard<std::mutex> lock(sleepMutex);
+    if (stopping) {
+      throw ExecutorShutdownException("Cannot post a task, the executor has been shut down");
+    }
+    pendingTasks.fetch_add(1);
+  }
+
+  auto index = (currentExecutor == this)
+      ? currentWorker
+      : nextWorker.fetch_add(1, std::memory_order_relaxed) % workers.size();
+
+  Item item {std::move(task), account ? account : defaultAccount};
+  item.account->onSubmitted();
+
+  auto& worker = *workers[index];
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.queues[static_cast<size_t>(priority)].push_back(std::move(item));
+  }
+
+  wakeUp.notify_one();
+}
+
+TaskAccountPtr WorkStealingExecutor::getAccount(std::string_view owner)
+{
+  std::lock_guard<std::mutex> lock(accountsMutex);
+  auto it = accounts.find(owner);
+  if (it == accounts.end()) {
+    it = accounts.emplace(owner, std::make_shared<TaskAccount>(owner)).first;
+  }
+  return it->second;
+}
+
+size_t WorkStealingExecutor::getConcurrency() const
+{
+  return workers.size();
+}
+
+WorkStealingExecutor::Stats WorkStealingExecutor::getStats() const
+{
+  Stats stats;
+  std::lock_guard<std::mutex> lock(accountsMutex);
+  for (const auto& [owner, account]: accounts) {
+    stats.push_back(account->getStats());
+  }
+  return stats;
+}
+
+void WorkStealingExecutor::run(size_t index)
+{
+  currentExecutor = this;
+  currentWorker = index;
+
+  Item item;
+  while (true) {
+    if (tryPop(index, item)) {
+      pendingTasks.fetch_sub(1);
+      execute(item);
+      if (currentExecutor != this) {
+        // the executor has been destroyed by the task
+        return;
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(sleepMutex);
+    wakeUp.wait(lock, [this](){return pendingTasks > 0 || stopping;});
+    if (stopping && pendingTasks == 0) {
+      break;
+    }
+  }
+
+  currentExecutor = nullptr;
+}
+
+bool WorkStealingExecutor::tryPop(size_t index, Item& item)
+{
+  for (size_t priority = 0; priority < TASK_PRIORITIES; ++priority) {
+    // own queue first, FIFO order
+    {
+      auto& worker = *workers[index];
+      std::lock_guard<std::mutex> lock(worker.mutex);
+      auto& queue = worker.queues[priority];
+      if (!queue.empty()) {
+        item = std::move(queue.front());
+        queue.pop_front();
+        return true;
+      }
+    }
+
+    // steal from the back of the other queues
+    for (size_t i = 1; i < workers.size(); ++i) {
+      auto& victim = *workers[(index + i) % workers.size()];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      auto& queue = victim.queues[priority];
+      if (!queue.empty()) {
+        item = std::move(queue.back());
+        queue.pop_back();
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void WorkStealingExecutor::execute(Item& item)
+{
+  auto start = std::chrono::steady_clock::now();
+  bool success = true;
+  try {
+    item.task();
+  }
+  catch (...) {
+    success = false;
+  }
+  item.account->onFinished(std::chrono::steady_clock::now() - start, success);
+
+  item.task = nullptr;
+  item.account = nullptr;
+}
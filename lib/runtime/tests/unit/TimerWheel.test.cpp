@@ -0,0 +1,153 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/runtime/TimerWheel.h"
+#include "cppps/runtime/WorkStealingExecutor.h"
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using cppps::TimerClient;
+using cppps::TimerWheel;
+using cppps::WorkStealingExecutor;
+using namespace std::chrono_literals;
+
+namespace test {
+namespace {
+
+constexpr auto OWNER_A = "A";
+constexpr auto OWNER_B = "B";
+constexpr size_t MANY_TIMERS = 100000;
+constexpr auto FINE_RESOLUTION = 10us;
+constexpr auto TIMEOUT = 5s;
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing hierarchical timer wheel", "[timers]")
+{
+  auto wheel = std::make_shared<TimerWheel>(nullptr, test::FINE_RESOLUTION);
+
+  SECTION("When one-shot timers expire, then the callbacks are called once in the deadline order and never early")
+  {
+    // delays covering the first three wheel levels
+    const std::vector<std::chrono::milliseconds> delays {700ms, 1ms, 200ms, 5ms};
+    std::mutex firedMutex;
+    std::vector<std::chrono::milliseconds> fired;
+    std::promise<void> done;
+    std::atomic_bool early {false};
+    auto start = TimerWheel::Clock::now();
+
+    for (auto delay: delays) {
+      wheel->schedule(delay, [&, delay](){
+        if (TimerWheel::Clock::now() - start < delay) {
+          early = true;
+        }
+        std::lock_guard<std::mutex> lock(firedMutex);
+        fired.push_back(delay);
+        if (fired.size() == delays.size()) {
+          done.set_value();
+        }
+      }, test::OWNER_A);
+    }
+
+    REQUIRE(done.get_future().wait_for(test::TIMEOUT) == std::future_status::ready);
+    REQUIRE(fired == std::vector<std::chrono::milliseconds>{1ms, 5ms, 200ms, 700ms});
+    REQUIRE_FALSE(early);
+    REQUIRE(wheel->getTimerCount() == 0);
+  }
+
+  SECTION("When a timer is cancelled, then its callback is not called")
+  {
+    std::atomic<int> calls {0};
+    auto id = wheel->schedule(20ms, [&calls](){calls.fetch_add(1);}, test::OWNER_A);
+    REQUIRE(wheel->cancel(id));
+    REQUIRE_FALSE(wheel->cancel(id));
+    REQUIRE(wheel->getTimerCount() == 0);
+
+    std::this_thread::sleep_for(50ms);
+    REQUIRE(calls == 0);
+  }
+
+  SECTION("When a periodic timer is scheduled, then it fires until cancelled")
+  {
+    std::atomic<int> calls {0};
+    std::promise<void> done;
+    auto id = wheel->schedulePeriodic(2ms, [&](){
+      if (calls.fetch_add(1) + 1 == 3) {
+        done.set_value();
+      }
+    }, test::OWNER_A);
+
+    REQUIRE(done.get_future().wait_for(test::TIMEOUT) == std::future_status::ready);
+    REQUIRE(wheel->cancel(id));
+    auto callsAfterCancel = calls.load();
+    std::this_thread::sleep_for(20ms);
+    REQUIRE(calls == callsAfterCancel);
+  }
+
+  SECTION("When the timers of an owner are cancelled, then the timers of other owners remain")
+  {
+    TimerClient clientA(wheel, test::OWNER_A);
+    TimerClient clientB(wheel, test::OWNER_B);
+    clientA.schedule(1s, [](){});
+    clientA.schedulePeriodic(1s, [](){});
+    auto idB = clientB.schedule(1s, [](){});
+
+    REQUIRE(clientA.cancelAll() == 2);
+    REQUIRE(wheel->getTimerCount() == 1);
+    REQUIRE(clientB.cancel(idB));
+  }
+
+  SECTION("When many timers are scheduled and cancelled, then the wheel stays consistent")
+  {
+    std::vector<TimerWheel::TimerId> ids;
+    ids.reserve(test::MANY_TIMERS);
+    for (size_t i = 0; i < test::MANY_TIMERS; ++i) {
+      ids.push_back(wheel->schedule(1s + std::chrono::microseconds(i), [](){}, test::OWNER_A));
+    }
+    REQUIRE(wheel->getTimerCount() == test::MANY_TIMERS);
+
+    for (size_t i = 0; i < test::MANY_TIMERS; i += 2) {
+      REQUIRE(wheel->cancel(ids[i]));
+    }
+    REQUIRE(wheel->getTimerCount() == test::MANY_TIMERS / 2);
+    REQUIRE(wheel->cancelOwner(test::OWNER_A) == test::MANY_TIMERS / 2);
+    REQUIRE(wheel->getTimerCount() == 0);
+  }
+
+  SECTION("When the wheel is shut down, then no timers can be scheduled")
+  {
+    wheel->schedule(1s, [](){}, test::OWNER_A);
+    wheel->shutdown();
+    REQUIRE(wheel->getTimerCount() == 0);
+    REQUIRE(wheel->schedule(1ms, [](){}, test::OWNER_A) == TimerWheel::INVALID_TIMER);
+  }
+}
+
+TEST_CASE("Testing timer wheel with executor", "[timers]")
+{
+  auto executor = std::make_shared<WorkStealingExecutor>(2);
+  auto wheel = std::make_shared<TimerWheel>(executor);
+
+  SECTION("When a timer expires, then its callback is executed by the executor on the owner account")
+  {
+    std::promise<std::thread::id> callbackThread;
+    wheel->schedule(1ms, [&callbackThread](){
+      callbackThread.set_value(std::this_thread::get_id());
+    }, test::OWNER_A);
+
+    auto result = callbackThread.get_future();
+    REQUIRE(result.wait_for(test::TIMEOUT) == std::future_status::ready);
+    REQUIRE(result.get() != std::this_thread::get_id());
+
+    wheel->shutdown();
+    executor->shutdown();
+    REQUIRE(executor->getAccount(test::OWNER_A)->getStats().completed == 1);
+  }
+}
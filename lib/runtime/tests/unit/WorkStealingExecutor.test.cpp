@@ -0,0 +1,172 @@
+// Copyright (c) 2026  Lukasz Chodyla
+// Distributed under the MIT License.
+// See accompanying file LICENSE.txt for the full license.
+
+#include "cppps/runtime/WorkStealingExecutor.h"
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using cppps::ExecutorClient;
+using cppps::ExecutorShutdownException;
+using cppps::TaskPriority;
+using cppps::WorkStealingExecutor;
+
+namespace test {
+namespace {
+
+constexpr size_t THREADS = 4;
+constexpr int TASKS = 1000;
+constexpr auto OWNER = "owner";
+constexpr auto TIMEOUT = std::chrono::seconds(5);
+
+} // namespace
+} // namespace test
+
+TEST_CASE("Testing work-stealing executor", "[executor]")
+{
+  auto executor = std::make_shared<WorkStealingExecutor>(test::THREADS);
+
+  SECTION("When an executor is created, then it runs the requested number of workers")
+  {
+    REQUIRE(executor->getConcurrency() == test::THREADS);
+  }
+
+  SECTION("When a function is submitted, then its result is available through the future")
+  {
+    auto result = executor->submit([](){return 42;});
+    REQUIRE(result.get() == 42);
+  }
+
+  SECTION("When a submitted function throws, then the exception is passed through the future")
+  {
+    auto result = executor->submit([](){throw std::logic_error("error");});
+    REQUIRE_THROWS_AS(result.get(), std::logic_error);
+  }
+
+  SECTION("When many tasks are posted, then all of them are executed")
+  {
+    std::atomic<int> counter {0};
+    std::vector<std::future<void>> results;
+    for (int i = 0; i < test::TASKS; ++i) {
+      results.push_back(executor->submit([&counter](){counter.fetch_add(1);}));
+    }
+    for (auto& result: results) {
+      result.get();
+    }
+    REQUIRE(counter == test::TASKS);
+  }
+
+  SECTION("When tasks post further tasks, then the nested tasks are executed too")
+  {
+    std::atomic<int> counter {0};
+    std::promise<void> done;
+    executor->post([&](){
+      for (int i = 0; i < test::TASKS; ++i) {
+        executor->post([&](){
+          if (counter.fetch_add(1) + 1 == test::TASKS) {
+            done.set_value();
+          }
+        }, TaskPriority::NORMAL, nullptr);
+      }
+    }, TaskPriority::NORMAL, nullptr);
+    done.get_future().get();
+    REQUIRE(counter == test::TASKS);
+  }
+
+  SECTION("When tasks of different priorities are queued, then the higher priorities are executed first")
+  {
+    auto single = std::make_shared<WorkStealingExecutor>(1);
+    std::promise<void> blocker;
+    auto blocked = blocker.get_future().share();
+    single->post([blocked](){blocked.wait();}, TaskPriority::HIGH, nullptr);
+
+    std::mutex orderMutex;
+    std::vector<TaskPriority> order;
+    std::vector<std::future<void>> results;
+    for (auto priority: {TaskPriority::LOW, TaskPriority::NORMAL, TaskPriority::HIGH}) {
+      results.push_back(single->submit([&, priority](){
+        std::lock_guard<std::mutex> lock(orderMutex);
+        order.push_back(priority);
+      }, priority));
+    }
+
+    blocker.set_value();
+    for (auto& result: results) {
+      result.get();
+    }
+    REQUIRE(order == std::vector<TaskPriority>{TaskPriority::HIGH, TaskPriority::NORMAL, TaskPriority::LOW});
+  }
+
+  SECTION("When a client submits tasks, then they are accounted to its owner")
+  {
+    ExecutorClient client(executor, test::OWNER);
+    client.submit([](){}).get();
+    client.submit([](){throw std::logic_error("error");}).wait();
+    client.post([](){throw std::logic_error("error");});
+    executor->shutdown();
+
+    auto stats = client.getStats();
+    REQUIRE(stats.owner == test::OWNER);
+    REQUIRE(stats.submitted == 3);
+    REQUIRE(stats.completed == 1);
+    REQUIRE(stats.failed == 2);
+
+    auto all = executor->getStats();
+    REQUIRE(std::any_of(all.begin(), all.end(), [](const auto& account){
+      return account.owner == test::OWNER;
+    }));
+    REQUIRE(executor->getAccount(test::OWNER) == executor->getAccount(test::OWNER));
+  }
+
+  SECTION("When a submitted function throws, then it is accounted as a failed task")
+  {
+    ExecutorClient client(executor, test::OWNER);
+    auto result = client.submit([](){throw std::logic_error("error");});
+    REQUIRE_THROWS_AS(result.get(), std::logic_error);
+    executor->shutdown();
+
+    auto stats = client.getStats();
+    REQUIRE(stats.completed == 0);
+    REQUIRE(stats.failed == 1);
+  }
+
+  SECTION("When an executor is shut down by its own task, then it can be destroyed")
+  {
+    executor->submit([&executor](){executor->shutdown();}).get();
+    REQUIRE_THROWS_AS(executor->post([](){}, TaskPriority::NORMAL, nullptr), ExecutorShutdownException);
+    executor.reset();
+  }
+
+  SECTION("When the last reference to an executor is released by its own task, then it is destroyed")
+  {
+    std::promise<void> released;
+    std::promise<void> destroyed;
+    executor->post([owner = executor, gate = released.get_future().share(), &destroyed]() mutable {
+      gate.wait();
+      owner.reset();
+      destroyed.set_value();
+    }, TaskPriority::NORMAL, nullptr);
+
+    executor.reset();
+    released.set_value();
+    REQUIRE(destroyed.get_future().wait_for(test::TIMEOUT) == std::future_status::ready);
+  }
+
+  SECTION("When an executor is shut down, then the pending tasks are drained and new tasks are rejected")
+  {
+    std::atomic<int> counter {0};
+    for (int i = 0; i < test::TASKS; ++i) {
+      executor->post([&counter](){counter.fetch_add(1);}, TaskPriority::LOW, nullptr);
+    }
+    executor->shutdown();
+    REQUIRE(counter == test::TASKS);
+    REQUIRE_THROWS_AS(executor->post([](){}, TaskPriority::NORMAL, nullptr), ExecutorShutdownException);
+  }
+}